@@ -13,8 +13,15 @@
 #include <QWidget>
 #include <QJsonObject>
 #include <QTextEdit> 
+#include <QPlainTextEdit>
 #include <QLineEdit>
 #include <QPushButton>
+#include <QAbstractButton>
+#include <QComboBox>
+#include <QBoxLayout>
+#include <QLabel>
+
+class QuestionHeader;
 
 class BaseQuestionEditor : public QWidget
 {
@@ -33,13 +40,79 @@ public:
         Q_UNUSED(json);
     }
 
+    // 💖 Dirty tracking! Anything the user touches marks the editor dirty, so
+    // clean questions never have to go through getJson() at all. loadJson()
+    // sets widgets too, so whoever calls it marks the editor clean afterwards.
+    bool isDirty() const { return m_dirty; }
+    void markClean() { m_dirty = false; }
+
+signals:
+    void changed();
+
+public slots:
+    void markDirty() {
+        m_dirty = true;
+        emit changed();
+    }
+
 protected:
-    // ✨ Our hint box for all the cute editor babies! ✨
-    QTextEdit* m_hintTextEdit;
+    // Hooks every input under root up to markDirty(). Safe to call again on
+    // the same widgets (rows get rebuilt), each signal is only connected once.
+    void trackEdits(QWidget *root) {
+        if (!root) return;
+        QList<QLineEdit*> lineEdits = root->findChildren<QLineEdit*>();
+        QList<QTextEdit*> textEdits = root->findChildren<QTextEdit*>();
+        QList<QPlainTextEdit*> plainTextEdits = root->findChildren<QPlainTextEdit*>();
+        QList<QComboBox*> combos = root->findChildren<QComboBox*>();
+        QList<QAbstractButton*> buttons = root->findChildren<QAbstractButton*>();
+        if (auto self = qobject_cast<QLineEdit*>(root)) lineEdits.append(self);
+        if (auto self = qobject_cast<QTextEdit*>(root)) textEdits.append(self);
+        if (auto self = qobject_cast<QPlainTextEdit*>(root)) plainTextEdits.append(self);
+        if (auto self = qobject_cast<QComboBox*>(root)) combos.append(self);
+        if (auto self = qobject_cast<QAbstractButton*>(root)) buttons.append(self);
+        for (QLineEdit *edit : lineEdits)
+            connect(edit, &QLineEdit::textChanged, this, &BaseQuestionEditor::markDirty, Qt::UniqueConnection);
+        for (QTextEdit *edit : textEdits)
+            connect(edit, &QTextEdit::textChanged, this, &BaseQuestionEditor::markDirty, Qt::UniqueConnection);
+        for (QPlainTextEdit *edit : plainTextEdits)
+            connect(edit, &QPlainTextEdit::textChanged, this, &BaseQuestionEditor::markDirty, Qt::UniqueConnection);
+        for (QComboBox *combo : combos)
+            connect(combo, &QComboBox::currentIndexChanged, this, &BaseQuestionEditor::markDirty, Qt::UniqueConnection);
+        // Add / remove / browse buttons and the answer toggles all count as edits.
+        for (QAbstractButton *button : buttons)
+            connect(button, &QAbstractButton::clicked, this, &BaseQuestionEditor::markDirty, Qt::UniqueConnection);
+    }
+
+    // Row helpers for the editors' lists (options, pairs, parts...). Adding,
+    // deleting or moving one row only touches that row's widget; the rows
+    // after it just get their number labels redone by the editor.
+    static int removeRow(QList<QWidget*> &rows, QBoxLayout *layout, QWidget *row) {
+        const int index = rows.indexOf(row);
+        if (index < 0) return -1;
+        rows.removeAt(index);
+        layout->removeWidget(row);
+        row->deleteLater();
+        return index;
+    }
+    static void moveRow(QList<QWidget*> &rows, QBoxLayout *layout, int from, int to) {
+        if (from == to || from < 0 || to < 0 || from >= rows.size() || to >= rows.size()) return;
+        QWidget *row = rows.at(from);
+        const int target = layout->indexOf(rows.at(to));
+        layout->removeWidget(row);
+        layout->insertWidget(target, row);
+        rows.move(from, to);
+    }
+    // The label a row shows its number in, tagged with setObjectName("rowNumber").
+    static QLabel *rowNumberLabel(QWidget *row) {
+        return row->findChild<QLabel*>("rowNumber");
+    }
+
+    // ✨ Lesson PDF, hint and media for all the cute editor babies! ✨
+    // Each editor makes one around its question prompt.
+    QuestionHeader* m_header = nullptr;
 
-    // These members are no longer needed here since each editor will manage its own UI.
-    // QLineEdit* m_lessonPdfEdit;
-    // QPushButton* m_lessonPdfButton;
+private:
+    bool m_dirty = false;
 };
 
 #endif // BASEQUESTIONEDITOR_H
@@ -0,0 +1,161 @@
+#include "benchmarks.h"
+#include "questionlistmodel.h"
+#include "questionstore.h"
+#include "quizwriter.h"
+#include "searchindex.h"
+
+#include <QBuffer>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QStringList>
+#include <QtGlobal>
+
+namespace {
+
+constexpr int ROUNDS = 5;
+
+// Resident memory in KB, or -1 where we can't tell (anything without /proc).
+qint64 residentKb()
+{
+    QFile status("/proc/self/status");
+    if (!status.open(QIODevice::ReadOnly | QIODevice::Text)) return -1;
+    while (!status.atEnd()) {
+        const QByteArray line = status.readLine();
+        if (line.startsWith("VmRSS:")) return line.mid(6).trimmed().split(' ').first().toLongLong();
+    }
+    return -1;
+}
+
+} // namespace
+
+bool Benchmarks::enabled()
+{
+    static const bool on = qEnvironmentVariableIsSet("WIFEY_BENCH");
+    return on;
+}
+
+void Benchmarks::report(const QString &line)
+{
+    qInfo().noquote() << "[bench]" << line;
+}
+
+QJsonObject Benchmarks::bankQuestion(const QList<QJsonObject> &samples, int n)
+{
+    static const QStringList words = {
+        "chat", "chien", "maison", "rouge", "bleu", "manger", "boire", "parler",
+        "ville", "livre", "soleil", "pluie", "école", "ami", "amie", "jardin",
+        "fromage", "pain", "train", "voiture", "mer", "montagne", "fleur", "café",
+        "chanter", "danser", "lire", "écrire", "matin", "soir", "hiver", "été"};
+    QJsonObject question = samples.at(n % samples.size());
+    question["question"] = QString("%1 %2 %3 %4 #%5")
+                               .arg(question["question"].toString())
+                               .arg(words.at(n % words.size()))
+                               .arg(words.at((n / 7) % words.size()))
+                               .arg(words.at((n / 49) % words.size()))
+                               .arg(n);
+    return question;
+}
+
+void Benchmarks::searchFiltering(const QList<QJsonObject> &samples)
+{
+    if (samples.isEmpty()) return;
+
+    QuestionStore store;
+    SearchIndex index;
+    QElapsedTimer timer;
+    timer.start();
+    for (int n = 0; n < BANK_SIZE; ++n) {
+        const QJsonObject question = bankQuestion(samples, n);
+        store.append(question);
+        index.update(store.id(n), store.revision(n), question);
+    }
+    report(QString("Search index: %1 questions built in %2 ms")
+               .arg(BANK_SIZE)
+               .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 0));
+
+    // As typed, one keystroke at a time, so the list goes through the same
+    // narrowing and widening it does for real.
+    const QStringList queries = {"c", "ch", "cha", "chat", "chat r", "chat ro", "chat rouge",
+                                 "chat rouge 12", "m", "ma", "mai", "zzz", "123"};
+    QuestionListModel model(&store);
+    QList<qint64> totalNs(queries.size(), 0);
+    QList<qint64> worstNs(queries.size(), 0);
+    QList<int> hits(queries.size(), 0);
+    for (int round = 0; round < ROUNDS; ++round) {
+        model.clearFilter();
+        for (int i = 0; i < queries.size(); ++i) {
+            timer.restart();
+            model.setFilter(index.search(queries[i]));
+            const qint64 elapsed = timer.nsecsElapsed();
+            totalNs[i] += elapsed;
+            worstNs[i] = qMax(worstNs[i], elapsed);
+            hits[i] = model.rowCount();
+        }
+    }
+    for (int i = 0; i < queries.size(); ++i) {
+        report(QString("Search \"%1\": %2 hits, avg %3 ms, worst %4 ms (budget 16 ms)")
+                   .arg(queries[i])
+                   .arg(hits[i])
+                   .arg(totalNs[i] / ROUNDS / 1e6, 0, 'f', 2)
+                   .arg(worstNs[i] / 1e6, 0, 'f', 2));
+    }
+}
+
+void Benchmarks::storeMemory(const QList<QJsonObject> &samples)
+{
+    if (samples.isEmpty()) return;
+    if (residentKb() < 0) {
+        report("Store memory: needs /proc/self/status, skipped");
+        return;
+    }
+
+    // Everything stays alive until the end, so each difference is only
+    // what that one form allocated.
+    qint64 before = residentKb();
+    QuestionStore edited;
+    for (int n = 0; n < BANK_SIZE; ++n) edited.append(bankQuestion(samples, n));
+    const qint64 editedKb = residentKb() - before;
+
+    // As opened from a file: its text, plus a summary and span per question.
+    before = residentKb();
+    QByteArray text;
+    QuestionStore loaded;
+    {
+        QBuffer buffer(&text);
+        buffer.open(QIODevice::WriteOnly);
+        QuizWriter writer(&buffer, QJsonDocument::Indented);
+        QList<QuestionSummary> summaries;
+        QList<QuestionSpan> spans;
+        for (int n = 0; n < BANK_SIZE; ++n) {
+            const QJsonObject question = bankQuestion(samples, n);
+            writer.writeQuestion(question);
+            summaries.append(QuestionSummary::of(question));
+            spans.append(writer.lastSpan());
+        }
+        writer.finish();
+        text.squeeze();
+        loaded.setSource(text);
+        loaded.appendIndexed(summaries, spans);
+    }
+    const qint64 loadedKb = residentKb() - before;
+
+    // What the editor used to keep: every question parsed into its own object.
+    before = residentKb();
+    QList<QJsonObject> parsed;
+    parsed.reserve(BANK_SIZE);
+    for (int n = 0; n < BANK_SIZE; ++n) {
+        const QByteArray element = QuizWriter::elementText(bankQuestion(samples, n), QJsonDocument::Indented);
+        parsed.append(QJsonDocument::fromJson(element).object());
+    }
+    const qint64 parsedKb = residentKb() - before;
+
+    report(QString("Store memory, %1 questions: QList<QJsonObject> %2 MB, store as opened %3 MB "
+                   "(%4 MB of it file text), store with every question edited %5 MB")
+               .arg(BANK_SIZE)
+               .arg(parsedKb / 1024.0, 0, 'f', 1)
+               .arg(loadedKb / 1024.0, 0, 'f', 1)
+               .arg(text.size() / (1024.0 * 1024.0), 0, 'f', 1)
+               .arg(editedKb / 1024.0, 0, 'f', 1));
+}
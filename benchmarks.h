@@ -0,0 +1,36 @@
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+// Opt-in timing reports, for checking the speed-ups without a profiler.
+// Nothing here runs (or logs) unless WIFEY_BENCH is set in the environment;
+// then the editor, search and store benchmarks run once after startup and
+// everything goes to the debug output, each line starting with "[bench]".
+// The thumbnail cache's hit rate is reported on exit.
+namespace Benchmarks {
+
+bool enabled();
+void report(const QString &line);
+
+constexpr int BANK_SIZE = 100000;
+
+// Question n of a made-up bank: samples (one per type) take turns, each
+// copy with a few words of its own so the index isn't a handful of giant
+// posting lists.
+QJsonObject bankQuestion(const QList<QJsonObject> &samples, int n);
+
+// Typing a few queries into the search box over a BANK_SIZE bank: index
+// lookup plus list filtering, against the 16 ms frame budget.
+void searchFiltering(const QList<QJsonObject> &samples);
+
+// Resident memory for a BANK_SIZE bank held as QJsonObjects, versus the
+// QuestionStore as opened from a file and with every question edited.
+// Linux only (reads /proc).
+void storeMemory(const QList<QJsonObject> &samples);
+
+}
+
+#endif // BENCHMARKS_H
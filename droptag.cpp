@@ -5,270 +5,274 @@
 #include <QMimeData>
 #include <QDrag>
 #include <QCursor>
+#include <QHelpEvent>
+#include <QToolTip>
 
 // DropTag implementation
-DropTag::DropTag(const QString &tagId, const QString &label, const QPoint &initialPos, QWidget *parent)
-    : QWidget(parent)
-    , m_tagId(tagId)
+DropTag::DropTag(const QString &tagId, const QString &label)
+    : m_tagId(tagId)
     , m_label(label)
-    , m_isDragging(false)
-    , m_dragStartPos(initialPos)
-    , m_lastPos(initialPos)
-    , m_font("Arial", 12, QFont::Bold)
-    , m_backgroundColor(Qt::black)
-    , m_textColor(Qt::yellow)
-    , m_borderColor(Qt::yellow)
+    , m_text(label)
 {
-    setAcceptDrops(true);
-    calculateSize();
-    setPosition(initialPos);
-    setToolTip(QString("Drag to position: %1").arg(m_label));
-    setCursor(Qt::OpenHandCursor);
+    m_text.setTextFormat(Qt::PlainText);
+    m_text.setPerformanceHint(QStaticText::AggressiveCaching);
+    m_text.prepare(QTransform(), font());
+    m_size = m_text.size().toSize() + QSize(2 * PADDING_X, 2 * PADDING_Y);
 }
 
-QPoint DropTag::currentPosition() const
+QFont DropTag::font()
 {
-    return pos();
+    return QFont("Arial", 12, QFont::Bold);
 }
 
-void DropTag::setPosition(const QPoint &pos)
+void DropTag::paint(QPainter &painter, const QRect &rect) const
 {
-    move(pos);
-    m_lastPos = pos;
+    QRect box = rect.adjusted(BORDER_WIDTH/2, BORDER_WIDTH/2,
+                              -BORDER_WIDTH/2, -BORDER_WIDTH/2);
+
+    // Draw background
+    painter.fillRect(box, Qt::black);
+
+    // Draw border
+    painter.setPen(QPen(Qt::yellow, BORDER_WIDTH));
+    painter.drawRect(box);
+
+    // Draw text
+    painter.setPen(Qt::yellow);
+    painter.drawStaticText(rect.topLeft() + QPoint(PADDING_X, PADDING_Y), m_text);
 }
 
-QSize DropTag::sizeHint() const
+// ImageTaggingWidget implementation
+ImageTaggingWidget::ImageTaggingWidget(QWidget *parent)
+    : TiledImageView(parent)
 {
-    return m_textSize + QSize(2 * PADDING_X, 2 * PADDING_Y);
+    setAcceptDrops(true);
+    setMinimumSize(400, 300);
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+    connect(this, &TiledImageView::imageLoaded, this, [this]() {
+        if (isVisible()) placeNewTags();
+    });
 }
 
-QSize DropTag::minimumSizeHint() const
+void ImageTaggingWidget::setBackgroundImage(const QString &imagePath)
 {
-    return sizeHint();
+    setImage(imagePath);
 }
 
-void DropTag::calculateSize()
+void ImageTaggingWidget::addTag(const QString &tagId, const QString &label, const QPoint &position)
 {
-    QFontMetrics metrics(m_font);
-    m_textSize = metrics.size(Qt::TextSingleLine, m_label);
-    setFixedSize(sizeHint());
+    if (m_tags.contains(tagId)) {
+        // Update existing tag
+        setTagPosition(tagId, position);
+        return;
+    }
+
+    DropTag tag(tagId, label);
+    tag.setPosition(position);
+    m_tags.insert(tagId, tag);
+    m_order.append(tagId);
+    ++m_nextSlot;
+    update(tagRect(tag));
 }
 
-void DropTag::updateGeometry()
+void ImageTaggingWidget::addTag(const QString &tagId, const QString &label)
 {
-    calculateSize();
-    update();
+    if (m_tags.contains(tagId)) return;
+
+    m_unplacedTags[tagId] = m_nextSlot;
+    addTag(tagId, label, QPoint());
+    if (isVisible()) placeNewTags();
 }
 
-void DropTag::paintEvent(QPaintEvent *event)
+// Stacked down the left edge like before, in view pixels, so they're
+// readable whatever the image's size. Needs the real view size and zoom,
+// hence waiting until we're shown and the image's size is known.
+void ImageTaggingWidget::placeNewTags()
 {
-    Q_UNUSED(event)
-    
-    QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
-    
-    QRect rect = this->rect().adjusted(BORDER_WIDTH/2, BORDER_WIDTH/2, 
-                                      -BORDER_WIDTH/2, -BORDER_WIDTH/2);
-    
-    // Draw background
-    painter.fillRect(rect, m_backgroundColor);
-    
-    // Draw border
-    painter.setPen(QPen(m_borderColor, BORDER_WIDTH));
-    painter.drawRect(rect);
-    
-    // Draw text
-    painter.setPen(m_textColor);
-    painter.setFont(m_font);
-    painter.drawText(rect, Qt::AlignCenter, m_label);
+    if (!hasImage() && !imagePath().isEmpty()) return; // imageLoaded brings us back
+    for (auto it = m_unplacedTags.cbegin(); it != m_unplacedTags.cend(); ++it) {
+        const QPoint viewPos(10, 10 + it.value() * 40);
+        m_tags[it.key()].setPosition(mapToImage(viewPos));
+    }
+    m_unplacedTags.clear();
+    update();
 }
 
-void DropTag::mousePressEvent(QMouseEvent *event)
+void ImageTaggingWidget::clearTags()
 {
-    if (event->button() == Qt::LeftButton) {
-        m_isDragging = false;
-        m_dragStartPos = event->pos();
-        setCursor(Qt::ClosedHandCursor);
-        emit tagSelected(m_tagId);
-    }
-    QWidget::mousePressEvent(event);
+    m_tags.clear();
+    m_order.clear();
+    m_unplacedTags.clear();
+    m_nextSlot = 0;
+    m_dragTag.clear();
+    update();
 }
 
-void DropTag::mouseMoveEvent(QMouseEvent *event)
+QPoint ImageTaggingWidget::getTagPosition(const QString &tagId) const
 {
-    if (!(event->buttons() & Qt::LeftButton)) {
-        return;
-    }
-    
-    if (!m_isDragging) {
-        int distance = (event->pos() - m_dragStartPos).manhattanLength();
-        if (distance >= QApplication::startDragDistance()) {
-            m_isDragging = true;
-        } else {
-            return;
-        }
-    }
-    
-    // Move the widget
-    QPoint newPos = pos() + event->pos() - m_dragStartPos;
-    
-    // Constrain to parent bounds if parent exists
-    if (parentWidget()) {
-        QRect parentRect = parentWidget()->rect();
-        newPos.setX(qMax(0, qMin(newPos.x(), parentRect.width() - width())));
-        newPos.setY(qMax(0, qMin(newPos.y(), parentRect.height() - height())));
+    if (m_tags.contains(tagId) && !m_unplacedTags.contains(tagId)) {
+        return m_tags[tagId].position().toPoint();
     }
-    
-    move(newPos);
-    m_lastPos = newPos;
-    
-    emit tagMoved(m_tagId, newPos);
-    
-    QWidget::mouseMoveEvent(event);
+    return QPoint(-1, -1);
 }
 
-void DropTag::mouseReleaseEvent(QMouseEvent *event)
+void ImageTaggingWidget::setTagPosition(const QString &tagId, const QPoint &pos)
 {
-    if (event->button() == Qt::LeftButton) {
-        m_isDragging = false;
-        setCursor(Qt::OpenHandCursor);
-        
-        if (m_lastPos != pos()) {
-            emit tagMoved(m_tagId, pos());
-        }
-    }
-    QWidget::mouseReleaseEvent(event);
+    setTagPositionInImage(tagId, pos);
 }
 
-void DropTag::dragEnterEvent(QDragEnterEvent *event)
+QStringList ImageTaggingWidget::getAllTagIds() const
 {
-    if (event->mimeData()->hasFormat("application/x-droptag")) {
-        event->acceptProposedAction();
-    }
+    QStringList ids = m_tags.keys();
+    ids.sort();
+    return ids;
 }
 
-void DropTag::dragMoveEvent(QDragMoveEvent *event)
+QRect ImageTaggingWidget::tagRect(const DropTag &tag) const
 {
-    if (event->mimeData()->hasFormat("application/x-droptag")) {
-        event->acceptProposedAction();
-    }
+    return QRect(mapFromImage(tag.position()).toPoint(), tag.size());
 }
 
-void DropTag::dropEvent(QDropEvent *event)
+// The one hit-test: topmost tag under the point, or none.
+QString ImageTaggingWidget::tagAt(const QPoint &viewPos) const
 {
-    if (event->mimeData()->hasFormat("application/x-droptag")) {
-        event->acceptProposedAction();
+    for (auto it = m_order.crbegin(); it != m_order.crend(); ++it) {
+        if (m_unplacedTags.contains(*it)) continue;
+        if (tagRect(*m_tags.constFind(*it)).contains(viewPos)) return *it;
     }
+    return QString();
 }
 
-// ImageTaggingWidget implementation
-ImageTaggingWidget::ImageTaggingWidget(QWidget *parent)
-    : QWidget(parent)
-    , m_scaleFactor(1.0)
-    , m_imageOffset(0, 0)
+// Only what the tag left and where it lands get repainted.
+void ImageTaggingWidget::moveTag(const QString &tagId, const QPointF &imagePos)
 {
-    setAcceptDrops(true);
-    setMinimumSize(400, 300);
-    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+    DropTag &tag = m_tags[tagId];
+    update(tagRect(tag));
+    tag.setPosition(imagePos);
+    update(tagRect(tag));
 }
 
-void ImageTaggingWidget::setBackgroundImage(const QString &imagePath)
+void ImageTaggingWidget::raiseTag(const QString &tagId)
 {
-    m_backgroundImagePath = imagePath;
-    m_backgroundPixmap = QPixmap(imagePath);
-    
-    if (!m_backgroundPixmap.isNull()) {
-        m_imageSize = m_backgroundPixmap.size();
-        setMinimumSize(m_imageSize);
-        updateTagPositions();
-        update();
-    }
+    if (m_order.isEmpty() || m_order.last() == tagId) return;
+    m_order.removeOne(tagId);
+    m_order.append(tagId);
+    update(tagRect(m_tags[tagId]));
 }
 
-void ImageTaggingWidget::addTag(const QString &tagId, const QString &label, const QPoint &position)
+void ImageTaggingWidget::paintOverlay(QPainter &painter, const QRect &rect)
 {
-    if (m_tags.contains(tagId)) {
-        // Update existing tag
-        DropTag *tag = m_tags[tagId];
-        tag->setPosition(position);
-        return;
+    if (m_tags.isEmpty()) return;
+
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setFont(DropTag::font());
+    for (const QString &tagId : std::as_const(m_order)) {
+        if (m_unplacedTags.contains(tagId)) continue;
+        const DropTag &tag = *m_tags.constFind(tagId);
+        const QRect box = tagRect(tag);
+        if (box.intersects(rect)) tag.paint(painter, box);
     }
-    
-    DropTag *tag = new DropTag(tagId, label, position, this);
-    
-    connect(tag, &DropTag::tagMoved, this, &ImageTaggingWidget::onTagMoved);
-    connect(tag, &DropTag::tagSelected, this, &ImageTaggingWidget::onTagSelected);
-    
-    m_tags[tagId] = tag;
-    tag->show();
-    tag->raise();
 }
 
-void ImageTaggingWidget::clearTags()
+bool ImageTaggingWidget::event(QEvent *event)
 {
-    for (auto it = m_tags.begin(); it != m_tags.end(); ++it) {
-        it.value()->deleteLater();
+    if (event->type() == QEvent::ToolTip) {
+        auto helpEvent = static_cast<QHelpEvent*>(event);
+        const QString tagId = tagAt(helpEvent->pos());
+        if (tagId.isEmpty()) {
+            QToolTip::hideText();
+            event->ignore();
+        } else {
+            QToolTip::showText(helpEvent->globalPos(),
+                               QString("Drag to position: %1").arg(m_tags[tagId].label()),
+                               this, tagRect(m_tags[tagId]));
+        }
+        return true;
     }
-    m_tags.clear();
+    return TiledImageView::event(event);
 }
 
-QPoint ImageTaggingWidget::getTagPosition(const QString &tagId) const
+void ImageTaggingWidget::showEvent(QShowEvent *event)
 {
-    if (m_tags.contains(tagId)) {
-        return m_tags[tagId]->currentPosition();
-    }
-    return QPoint(-1, -1);
+    TiledImageView::showEvent(event);
+    placeNewTags();
 }
 
-void ImageTaggingWidget::setTagPosition(const QString &tagId, const QPoint &pos)
+void ImageTaggingWidget::mousePressEvent(QMouseEvent *event)
 {
-    if (m_tags.contains(tagId)) {
-        m_tags[tagId]->setPosition(pos);
+    const QString tagId = event->button() == Qt::LeftButton ? tagAt(event->pos()) : QString();
+    if (tagId.isEmpty()) {
+        TiledImageView::mousePressEvent(event); // Not on a tag: pan the image
+        return;
     }
+
+    m_dragTag = tagId;
+    m_isDragging = false;
+    m_dragStartPos = event->pos();
+    m_grabOffset = event->pos() - tagRect(m_tags[tagId]).topLeft();
+    setCursor(Qt::ClosedHandCursor);
+
+    // Bring selected tag to front
+    raiseTag(tagId);
+    emit tagSelected(tagId);
 }
 
-QStringList ImageTaggingWidget::getAllTagIds() const
+void ImageTaggingWidget::mouseMoveEvent(QMouseEvent *event)
 {
-    return m_tags.keys();
+    if (m_dragTag.isEmpty()) {
+        TiledImageView::mouseMoveEvent(event);
+        return;
+    }
+    if (!(event->buttons() & Qt::LeftButton)) {
+        return;
+    }
+
+    if (!m_isDragging) {
+        int distance = (event->pos() - m_dragStartPos).manhattanLength();
+        if (distance >= QApplication::startDragDistance()) {
+            m_isDragging = true;
+        } else {
+            return;
+        }
+    }
+
+    // Constrain to our bounds
+    const QSize size = m_tags[m_dragTag].size();
+    QPoint newPos = event->pos() - m_grabOffset;
+    newPos.setX(qMax(0, qMin(newPos.x(), width() - size.width())));
+    newPos.setY(qMax(0, qMin(newPos.y(), height() - size.height())));
+
+    const QPointF imagePos = mapToImage(newPos);
+    moveTag(m_dragTag, imagePos);
+
+    emit tagMoved(m_dragTag, newPos);
+    emit tagPositionChanged(m_dragTag, imagePos.toPoint());
 }
 
-void ImageTaggingWidget::paintEvent(QPaintEvent *event)
+void ImageTaggingWidget::mouseReleaseEvent(QMouseEvent *event)
 {
-    Q_UNUSED(event)
-    
-    QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
-    
-    if (!m_backgroundPixmap.isNull()) {
-        // Calculate scaling and offset to center the image
-        QSize widgetSize = size();
-        QSize imageSize = m_backgroundPixmap.size();
-        
-        m_scaleFactor = qMin(
-            double(widgetSize.width()) / imageSize.width(),
-            double(widgetSize.height()) / imageSize.height()
-        );
-        
-        QSize scaledSize = imageSize * m_scaleFactor;
-        m_imageOffset = QPoint(
-            (widgetSize.width() - scaledSize.width()) / 2,
-            (widgetSize.height() - scaledSize.height()) / 2
-        );
-        
-        QRect drawRect(m_imageOffset, scaledSize);
-        painter.drawPixmap(drawRect, m_backgroundPixmap);
+    if (m_dragTag.isEmpty() || event->button() != Qt::LeftButton) {
+        TiledImageView::mouseReleaseEvent(event);
+        return;
+    }
+
+    m_dragTag.clear();
+    m_isDragging = false;
+    if (hasImage()) {
+        setCursor(Qt::OpenHandCursor);
     } else {
-        // Draw placeholder
-        painter.fillRect(rect(), Qt::lightGray);
-        painter.setPen(Qt::darkGray);
-        painter.drawText(rect(), Qt::AlignCenter, "No Image Loaded");
+        unsetCursor();
     }
 }
 
-void ImageTaggingWidget::resizeEvent(QResizeEvent *event)
+void ImageTaggingWidget::mouseDoubleClickEvent(QMouseEvent *event)
 {
-    QWidget::resizeEvent(event);
-    updateTagPositions();
+    // A quick double grab of a tag shouldn't zoom the image.
+    if (!tagAt(event->pos()).isEmpty()) {
+        event->accept();
+        return;
+    }
+    TiledImageView::mouseDoubleClickEvent(event);
 }
 
 void ImageTaggingWidget::dragEnterEvent(QDragEnterEvent *event)
@@ -290,61 +294,32 @@ void ImageTaggingWidget::dropEvent(QDropEvent *event)
     if (event->mimeData()->hasFormat("application/x-droptag")) {
         QByteArray data = event->mimeData()->data("application/x-droptag");
         QString tagId = QString::fromUtf8(data);
-        
+
         if (m_tags.contains(tagId)) {
-            QPoint dropPos = event->position().toPoint();
-            m_tags[tagId]->setPosition(dropPos);
-            emit tagPositionChanged(tagId, dropPos);
+            const QPointF imagePos = mapToImage(event->position());
+            setTagPositionInImage(tagId, imagePos);
+            emit tagPositionChanged(tagId, imagePos.toPoint());
         }
-        
-        event->acceptProposedAction();
-    }
-}
-
-void ImageTaggingWidget::onTagMoved(const QString &tagId, const QPoint &newPos)
-{
-    emit tagPositionChanged(tagId, newPos);
-}
-
-void ImageTaggingWidget::onTagSelected(const QString &tagId)
-{
-    emit tagSelected(tagId);
-    
-    // Bring selected tag to front
-    if (m_tags.contains(tagId)) {
-        m_tags[tagId]->raise();
-    }
-}
 
-void ImageTaggingWidget::updateTagPositions()
-{
-    // Scale tag positions based on current widget size vs image size
-    if (m_backgroundPixmap.isNull()) return;
-    
-    for (auto it = m_tags.begin(); it != m_tags.end(); ++it) {
-        DropTag *tag = it.value();
-        QPoint currentPos = tag->currentPosition();
-        
-        // Apply scaling and offset if needed
-        // This could be enhanced to maintain relative positions when resizing
-        tag->setPosition(currentPos);
+        event->acceptProposedAction();
     }
 }
 
 QPointF ImageTaggingWidget::tagPositionInImage(const QString &tagId) const
 {
-    if (!m_tags.contains(tagId) || m_backgroundPixmap.isNull())
+    if (!m_tags.contains(tagId) || m_unplacedTags.contains(tagId) || !hasImage())
         return QPointF(-1, -1);
-    // DropTag position in widget space:
-    QPoint widgetPos = m_tags[tagId]->currentPosition();
-    // Convert to natural image coordinates (undo offset and scaling):
-    return (widgetPos - m_imageOffset) / m_scaleFactor;
+    return m_tags[tagId].position();
 }
 
 void ImageTaggingWidget::setTagPositionInImage(const QString &tagId, const QPointF &imgPt)
 {
-    if (!m_tags.contains(tagId) || m_backgroundPixmap.isNull())
+    if (!m_tags.contains(tagId))
+        return;
+    if (m_unplacedTags.remove(tagId)) {
+        m_tags[tagId].setPosition(imgPt);
+        update(tagRect(m_tags[tagId]));
         return;
-    QPoint widgetPt = (imgPt * m_scaleFactor).toPoint() + m_imageOffset;
-    m_tags[tagId]->setPosition(widgetPt);
-}
\ No newline at end of file
+    }
+    moveTag(tagId, imgPt);
+}
@@ -19,58 +19,40 @@
 #include <QColor>
 #include <QPen>
 #include <QBrush>
+#include <QStaticText>
+#include <QHash>
 
-class DropTag : public QWidget
-{
-    Q_OBJECT
+#include "tiledimageview.h"
 
+// One tag on the image: just its data and how to draw it. ImageTaggingWidget
+// owns, paints and hit-tests them all itself, so a 300-tag exercise is 300
+// small values instead of 300 widgets with their own events and paints.
+class DropTag
+{
 public:
-    explicit DropTag(const QString &tagId, 
-                     const QString &label, 
-                     const QPoint &initialPos,
-                     QWidget *parent = nullptr);
+    DropTag() = default;
+    DropTag(const QString &tagId, const QString &label);
     
     QString tagId() const { return m_tagId; }
     QString label() const { return m_label; }
-    QPoint currentPosition() const;
-    void setPosition(const QPoint &pos);
+    QSize size() const { return m_size; }
     
-    // Size management
-    QSize sizeHint() const override;
-    QSize minimumSizeHint() const override;
-
-protected:
-    void paintEvent(QPaintEvent *event) override;
-    void mousePressEvent(QMouseEvent *event) override;
-    void mouseMoveEvent(QMouseEvent *event) override;
-    void mouseReleaseEvent(QMouseEvent *event) override;
+    // Top left, in image coordinates
+    QPointF position() const { return m_position; }
+    void setPosition(const QPointF &pos) { m_position = pos; }
     
-    void dragEnterEvent(QDragEnterEvent *event) override;
-    void dragMoveEvent(QDragMoveEvent *event) override;
-    void dropEvent(QDropEvent *event) override;
-
-signals:
-    void tagMoved(const QString &tagId, const QPoint &newPos);
-    void tagSelected(const QString &tagId);
+    // Expects the painter's font to be font()
+    void paint(QPainter &painter, const QRect &rect) const;
+    static QFont font();
 
 private:
-    void calculateSize();
-    void updateGeometry();
-    
     QString m_tagId;
     QString m_label;
+    QPointF m_position;
     
-    // Dragging state
-    bool m_isDragging;
-    QPoint m_dragStartPos;
-    QPoint m_lastPos;
-    
-    // Appearance
-    QFont m_font;
-    QSize m_textSize;
-    QColor m_backgroundColor;
-    QColor m_textColor;
-    QColor m_borderColor;
+    // Laid out once, not on every paint
+    QStaticText m_text;
+    QSize m_size;
     
     // Layout constants
     static constexpr int PADDING_X = 6;
@@ -78,8 +60,10 @@ private:
     static constexpr int BORDER_WIDTH = 2;
 };
 
-// Custom widget for holding draggable tags over an image
-class ImageTaggingWidget : public QWidget
+// Custom widget for holding draggable tags over an image. Tags are kept in
+// image coordinates, so they stay on their spot of the picture however far
+// it's zoomed or panned.
+class ImageTaggingWidget : public TiledImageView
 {
     Q_OBJECT
 
@@ -87,48 +71,60 @@ public:
     explicit ImageTaggingWidget(QWidget *parent = nullptr);
     
     void setBackgroundImage(const QString &imagePath);
+    // Position in image coordinates. Without one the tag starts in the next
+    // free spot down the left edge of the view.
     void addTag(const QString &tagId, const QString &label, const QPoint &position);
+    void addTag(const QString &tagId, const QString &label);
     void clearTags();
     
-    // Tag management
+    // Tag management, in image coordinates
     QPoint getTagPosition(const QString &tagId) const;
     void setTagPosition(const QString &tagId, const QPoint &pos);
     QStringList getAllTagIds() const;
     
     // Image management
-    QString backgroundImagePath() const { return m_backgroundImagePath; }
-    QSize imageSize() const { return m_imageSize; }
+    QString backgroundImagePath() const { return imagePath(); }
 
     // Scalling
     QPointF tagPositionInImage(const QString &tagId) const;
     void setTagPositionInImage(const QString &tagId, const QPointF &imgPt);
     
 protected:
-    void paintEvent(QPaintEvent *event) override;
-    void resizeEvent(QResizeEvent *event) override;
+    bool event(QEvent *event) override;
+    void paintOverlay(QPainter &painter, const QRect &rect) override;
+    void showEvent(QShowEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseDoubleClickEvent(QMouseEvent *event) override;
     void dragEnterEvent(QDragEnterEvent *event) override;
     void dragMoveEvent(QDragMoveEvent *event) override;
     void dropEvent(QDropEvent *event) override;
 
-private slots:
-    void onTagMoved(const QString &tagId, const QPoint &newPos);
-    void onTagSelected(const QString &tagId);
-
 signals:
+    // While a tag is dragged; newPos is its top left in view coordinates
+    void tagMoved(const QString &tagId, const QPoint &newPos);
+    // newPos is in image coordinates
     void tagPositionChanged(const QString &tagId, const QPoint &newPos);
     void tagSelected(const QString &tagId);
 
 private:
-    void updateTagPositions();
+    QString tagAt(const QPoint &viewPos) const;
+    QRect tagRect(const DropTag &tag) const;
+    void moveTag(const QString &tagId, const QPointF &imagePos);
+    void raiseTag(const QString &tagId);
+    void placeNewTags();
     
-    QString m_backgroundImagePath;
-    QPixmap m_backgroundPixmap;
-    QSize m_imageSize;
-    QMap<QString, DropTag*> m_tags;
+    QHash<QString, DropTag> m_tags;
+    QStringList m_order;                // Paint order, topmost last
+    QHash<QString, int> m_unplacedTags; // Waiting for the view to be laid out, with their spot
+    int m_nextSlot = 0;
     
-    // Scaling for display
-    double m_scaleFactor;
-    QPoint m_imageOffset;
+    // Dragging state
+    QString m_dragTag;
+    bool m_isDragging = false;
+    QPoint m_dragStartPos;
+    QPoint m_grabOffset; // Where in the tag it was grabbed
 };
 
 #endif // DROPTAG_H
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "editjournal.h"
+
+#include <QDateTime>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonParseError>
+
+QString EditJournal::journalPathFor(const QString &quizPath)
+{
+    return quizPath + ".journal";
+}
+
+// Size + modification time is enough to notice the file changed under us,
+// without hashing the whole bank every time it's opened.
+QJsonObject EditJournal::baseHeader(const QString &quizPath)
+{
+    const QFileInfo info(quizPath);
+    QJsonObject header;
+    header["journal"] = 1;
+    header["size"] = double(info.size());
+    header["mtime"] = double(info.lastModified().toMSecsSinceEpoch());
+    return header;
+}
+
+int EditJournal::replay(const QString &quizPath, QuestionStore &store, const QSet<quint64> &keep)
+{
+    QFile file(journalPathFor(quizPath));
+    if (!file.open(QIODevice::ReadOnly)) return 0;
+    if (QJsonDocument::fromJson(file.readLine()).object() != baseHeader(quizPath)) return 0;
+
+    int applied = 0;
+    while (!file.atEnd()) {
+        QJsonParseError error;
+        const QJsonObject record = QJsonDocument::fromJson(file.readLine(), &error).object();
+        // A torn last line is what a crash mid-write looks like; everything before it is good.
+        if (error.error != QJsonParseError::NoError) break;
+
+        const QString op = record["op"].toString();
+        const int index = record["i"].toInt(-1);
+        if (op == "set" && index >= 0 && index < store.size()) {
+            if (keep.contains(store.id(index))) continue;
+            store.replace(index, record["q"].toObject());
+        } else if (op == "insert" && index >= 0 && index <= store.size()) {
+            store.insert(index, record["q"].toObject());
+        } else if (op == "remove" && index >= 0 && index < store.size()) {
+            store.removeAt(index);
+        } else {
+            break; // Out of step with the file; stop before making things worse.
+        }
+        ++applied;
+    }
+    return applied;
+}
+
+bool EditJournal::open(const QString &quizPath)
+{
+    m_quizPath = quizPath;
+    return begin(true);
+}
+
+bool EditJournal::restart()
+{
+    return begin(false);
+}
+
+bool EditJournal::begin(bool keepExisting)
+{
+    m_file.close();
+    m_records = 0;
+    if (m_quizPath.isEmpty()) return false;
+    m_file.setFileName(journalPathFor(m_quizPath));
+
+    const QJsonObject header = baseHeader(m_quizPath);
+    if (keepExisting && m_file.open(QIODevice::ReadOnly)) {
+        const bool matches = QJsonDocument::fromJson(m_file.readLine()).object() == header;
+        while (matches && !m_file.atEnd()) {
+            m_file.readLine();
+            ++m_records;
+        }
+        m_file.close();
+        if (matches) return m_file.open(QIODevice::WriteOnly | QIODevice::Append);
+        m_records = 0;
+    }
+
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+    m_file.write(QJsonDocument(header).toJson(QJsonDocument::Compact) + '\n');
+    m_file.flush();
+    return true;
+}
+
+void EditJournal::close()
+{
+    m_file.close();
+    m_file.setFileName(QString());
+    m_quizPath.clear();
+    m_records = 0;
+}
+
+void EditJournal::discard()
+{
+    const QString path = m_file.fileName();
+    close();
+    if (!path.isEmpty()) QFile::remove(path);
+}
+
+void EditJournal::append(const QJsonObject &record)
+{
+    if (!m_file.isOpen()) return;
+    // Flushed every time: a crash of the editor must not take the last edit with it.
+    m_file.write(QJsonDocument(record).toJson(QJsonDocument::Compact) + '\n');
+    m_file.flush();
+    ++m_records;
+}
+
+void EditJournal::recordSet(int index, const QJsonObject &question)
+{
+    append(QJsonObject{{"op", "set"}, {"i", index}, {"q", question}});
+}
+
+void EditJournal::recordInsert(int index, const QJsonObject &question)
+{
+    append(QJsonObject{{"op", "insert"}, {"i", index}, {"q", question}});
+}
+
+void EditJournal::recordRemove(int index)
+{
+    append(QJsonObject{{"op", "remove"}, {"i", index}});
+}
+
+void EditJournal::recordUnsaved(const QuestionStore::Snapshot &saved, const QuestionStore &store)
+{
+    if (!m_file.isOpen()) return;
+    QSet<quint64> current;
+    current.reserve(store.size());
+    for (int i = 0; i < store.size(); ++i) current.insert(store.id(i));
+
+    // Back to front, so the indices of the ones still to go don't move.
+    QSet<quint64> inFile;
+    inFile.reserve(saved.items.size());
+    for (qsizetype i = saved.items.size() - 1; i >= 0; --i) {
+        if (current.contains(saved.items[i].id)) inFile.insert(saved.items[i].id);
+        else recordRemove(int(i));
+    }
+
+    // What's left keeps its order, so walking the store lines both lists up.
+    for (int i = 0; i < store.size(); ++i) {
+        if (!inFile.contains(store.id(i))) recordInsert(i, store.at(i));
+        else if (store.isDirty(i)) recordSet(i, store.at(i));
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef EDITJOURNAL_H
+#define EDITJOURNAL_H
+
+#include <QFile>
+#include <QJsonObject>
+#include <QSet>
+#include <QString>
+#include "questionstore.h"
+
+// Crash insurance for unsaved edits. Every change to a question is appended
+// as one compact JSON line to "<quiz file>.journal", so writing it costs about
+// as much as the edit itself. The first line remembers which version of the
+// quiz file the edits apply to; replay() puts them back after a crash, and a
+// save starts the journal over because the file has caught up.
+class EditJournal
+{
+public:
+    static QString journalPathFor(const QString &quizPath);
+
+    // Re-applies a journal left behind for quizPath. Returns how many edits
+    // were recovered; a journal written against another version of the file
+    // is ignored. Questions in keep (by id) were edited again since, so
+    // their old edits are skipped rather than written over the new ones.
+    static int replay(const QString &quizPath, QuestionStore &store, const QSet<quint64> &keep = {});
+
+    // Starts recording for quizPath. Keeps an existing journal that matches
+    // the file (we just replayed it), otherwise begins a fresh one.
+    bool open(const QString &quizPath);
+    // Throws away everything recorded so far and starts clean against the
+    // file as it is on disk now. Called once a save has landed.
+    bool restart();
+    void close();
+    // Stops recording and deletes the journal; the edits were given up on purpose.
+    void discard();
+
+    bool isOpen() const { return m_file.isOpen(); }
+    QString quizPath() const { return m_quizPath; }
+    int recordCount() const { return m_records; }
+
+    void recordSet(int index, const QJsonObject &question);
+    void recordInsert(int index, const QJsonObject &question);
+    void recordRemove(int index);
+    // After a save that didn't catch everything: whatever turns the file as
+    // written from saved into the store now. Removes for the questions that
+    // are gone, then a set or insert for each one that's still dirty, so
+    // only what changed during the save gets decoded.
+    void recordUnsaved(const QuestionStore::Snapshot &saved, const QuestionStore &store);
+
+private:
+    static QJsonObject baseHeader(const QString &quizPath);
+    bool begin(bool keepExisting);
+    void append(const QJsonObject &record);
+
+    QFile m_file;
+    QString m_quizPath;
+    int m_records = 0;
+};
+
+#endif // EDITJOURNAL_H
@@ -12,6 +12,7 @@
 #define CATEGORIZATIONEDITOR_H
 
 #include "../basequestioneditor.h"
+#include "itemtable.h"
 #include <QtWidgets>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -28,32 +29,23 @@ public:
 private slots:
     void addCategory();
     void addStimulus();
-    void browseMedia();
-    void browseStimulusImage(QLineEdit* imageEdit);
     // 💖 Our new magical slot to update the UI when a category name changes! 💖
     void onCategoryNameChanged(int index, const QString& newText);
 
 private:
     void refreshCategoriesUI();
     void refreshStimuliUI();
+    void appendCategoryRow(const QString &categoryText);
     void clearCategories();
-    void clearStimuli();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
     QVBoxLayout* m_categoriesLayout;
-    QVBoxLayout* m_stimuliLayout;
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
+    ItemTable* m_stimuliTable;
 
     // Data storage
     QJsonObject m_currentQuestion;
     QList<QWidget*> m_categoryWidgets;
-    QList<QWidget*> m_stimuliWidgets;
 };
 
 #endif // CATEGORIZATIONEDITOR_H
@@ -0,0 +1,208 @@
+#include "clozeedit.h"
+
+#include <QColor>
+#include <QSyntaxHighlighter>
+#include <QTextBlock>
+#include <QTextCharFormat>
+
+namespace {
+
+const QString kOpen = QStringLiteral("[[");
+const QString kClose = QStringLiteral("]]");
+
+// Where the next complete blank is, from its "[[" to its "]]". Anything after
+// a backslash is plain text, so "\[[" never opens a blank and "\]]" never
+// closes one.
+bool findBlank(const QString &line, qsizetype from, qsizetype &open, qsizetype &close)
+{
+    for (qsizetype i = from; i < line.size(); ++i) {
+        if (line.at(i) == '\\') {
+            ++i;
+        } else if (QStringView(line).mid(i).startsWith(kOpen)) {
+            for (qsizetype j = i + kOpen.size(); j < line.size(); ++j) {
+                if (line.at(j) == '\\') {
+                    ++j;
+                } else if (QStringView(line).mid(j).startsWith(kClose)) {
+                    open = i;
+                    close = j;
+                    return true;
+                }
+            }
+            return false; // Nothing closes it, so nothing after it can be closed either
+        }
+    }
+    return false;
+}
+
+// On the unescaped '|' only; the options keep their escapes.
+QStringList splitOptions(QStringView blank)
+{
+    QStringList options;
+    qsizetype start = 0;
+    for (qsizetype i = 0; i < blank.size(); ++i) {
+        if (blank.at(i) == '\\') {
+            ++i;
+        } else if (blank.at(i) == '|') {
+            options.append(blank.mid(start, i - start).toString());
+            start = i + 1;
+        }
+    }
+    options.append(blank.mid(start).toString());
+    return options;
+}
+
+// Text around the blanks only needs "[[" and backslashes taken care of; a
+// trailing '[' would run into the blank after it.
+QString escapeText(const QString &text)
+{
+    QString escaped;
+    escaped.reserve(text.size());
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        const QChar c = text.at(i);
+        if (c == '\\' || (c == '[' && (i + 1 == text.size() || text.at(i + 1) == '['))) escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// What one line parsed to, kept on the line itself.
+struct ClozeBlockData : QTextBlockUserData
+{
+    QStringList texts;         // Always one more than blanks
+    QList<QStringList> blanks;
+};
+
+// Qt only re-highlights the lines an edit touched, so parsing here (and
+// caching the result on the block) re-parses just the edited line instead of
+// the whole cloze. Colouring the blanks comes for free.
+class ClozeHighlighter : public QSyntaxHighlighter
+{
+public:
+    using QSyntaxHighlighter::QSyntaxHighlighter;
+
+protected:
+    void highlightBlock(const QString &text) override
+    {
+        auto data = new ClozeBlockData;
+        ClozeEdit::parseLine(text, data->texts, data->blanks);
+        setCurrentBlockUserData(data);
+
+        QTextCharFormat blankFormat;
+        blankFormat.setBackground(QColor("#FFC0CB"));
+        blankFormat.setForeground(QColor("#C71585"));
+        blankFormat.setFontWeight(QFont::Bold);
+
+        qsizetype from = 0;
+        qsizetype open = 0;
+        qsizetype close = 0;
+        while (findBlank(text, from, open, close)) {
+            setFormat(int(open), int(close + kClose.size() - open), blankFormat);
+            from = close + kClose.size();
+        }
+    }
+};
+
+}
+
+ClozeEdit::ClozeEdit(QWidget *parent) : QPlainTextEdit(parent)
+{
+    new ClozeHighlighter(document());
+}
+
+QString ClozeEdit::escape(const QString &option)
+{
+    QString escaped;
+    escaped.reserve(option.size());
+    for (qsizetype i = 0; i < option.size(); ++i) {
+        const QChar c = option.at(i);
+        if (c == '\n') {
+            escaped += QStringLiteral("\\n");
+            continue;
+        }
+        if (c == '\\' || c == '|' || c == '[' || c == ']' || (i == 0 && c == '*')) escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+QString ClozeEdit::unescape(QStringView text)
+{
+    QString plain;
+    plain.reserve(text.size());
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        if (text.at(i) == '\\' && i + 1 < text.size()) {
+            ++i;
+            plain += text.at(i) == 'n' ? QChar('\n') : text.at(i);
+        } else {
+            plain += text.at(i);
+        }
+    }
+    return plain;
+}
+
+void ClozeEdit::parseLine(const QString &line, QStringList &texts, QList<QStringList> &blanks)
+{
+    texts.clear();
+    blanks.clear();
+
+    qsizetype from = 0;
+    qsizetype open = 0;
+    qsizetype close = 0;
+    while (findBlank(line, from, open, close)) {
+        texts.append(unescape(QStringView(line).mid(from, open - from)));
+        blanks.append(splitOptions(QStringView(line).mid(open + kOpen.size(), close - open - kOpen.size())));
+        from = close + kClose.size();
+    }
+    // No more complete blanks; a lone "[[" is just text.
+    texts.append(unescape(QStringView(line).mid(from)));
+}
+
+void ClozeEdit::setCloze(const QStringList &parts, const QList<QStringList> &blanks)
+{
+    QString text;
+    for (int i = 0; i < blanks.size(); ++i) {
+        text += escapeText(parts.value(i));
+        text += kOpen + blanks[i].join('|') + kClose;
+    }
+    for (int i = blanks.size(); i < parts.size(); ++i) text += escapeText(parts[i]);
+    setPlainText(text);
+}
+
+void ClozeEdit::cloze(QStringList &parts, QList<QStringList> &blanks) const
+{
+    parts = {QString()};
+    blanks.clear();
+
+    QStringList texts;
+    QList<QStringList> lineBlanks;
+    for (QTextBlock block = document()->begin(); block.isValid(); block = block.next()) {
+        if (block != document()->begin()) parts.last() += '\n';
+
+        // The highlighter has normally parsed the line already.
+        if (auto data = static_cast<ClozeBlockData*>(block.userData())) {
+            texts = data->texts;
+            lineBlanks = data->blanks;
+        } else {
+            parseLine(block.text(), texts, lineBlanks);
+        }
+
+        parts.last() += texts.first();
+        for (int i = 0; i < lineBlanks.size(); ++i) {
+            blanks.append(lineBlanks[i]);
+            parts.append(texts[i + 1]);
+        }
+    }
+}
+
+void ClozeEdit::insertBlank(const QString &text)
+{
+    QTextCursor cursor = textCursor();
+    QString inside = text;
+    if (cursor.hasSelection()) {
+        // Blanks stay on one line; line breaks in them are escaped.
+        inside = escape(cursor.selectedText().replace(QChar::ParagraphSeparator, '\n'));
+    }
+    cursor.insertText(kOpen + inside + kClose);
+    setTextCursor(cursor);
+    setFocus();
+}
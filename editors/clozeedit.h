@@ -0,0 +1,50 @@
+/*
+* File: clozeedit.h
+*
+* Description:
+* One text box for a whole fill-in-the-blanks sentence! Blanks are typed
+* inline as [[answer]] or [[option|option|...]], so a cloze with 80 gaps is
+* still just one widget instead of hundreds of little text boxes. 💖
+*
+* A backslash makes the next character plain text: \[[ isn't a blank, and
+* inside one \| \] \* aren't special either. \n is a line break, which is
+* the only way to get one into a blank.
+*/
+
+#ifndef CLOZEEDIT_H
+#define CLOZEEDIT_H
+
+#include <QList>
+#include <QPlainTextEdit>
+#include <QStringList>
+#include <QStringView>
+
+class ClozeEdit : public QPlainTextEdit
+{
+    Q_OBJECT
+
+public:
+    explicit ClozeEdit(QWidget *parent = nullptr);
+
+    // parts are the text around the blanks (sentence_parts), plain text both
+    // ways. blanks are what each [[...]] holds, split on '|' and untrimmed,
+    // still escaped: run options through escape() going in and unescape()
+    // coming out (a leading unescaped '*' is left for the editor to read).
+    // Reading always gives back one more part than blanks; extra parts when
+    // writing end up in the tail.
+    void setCloze(const QStringList &parts, const QList<QStringList> &blanks);
+    void cloze(QStringList &parts, QList<QStringList> &blanks) const;
+
+    static QString escape(const QString &option);
+    static QString unescape(QStringView text);
+
+    // Wraps the selection in [[ ]], or drops text (already escaped) in as a
+    // new blank.
+    void insertBlank(const QString &text);
+
+    // Splits one line into its text pieces and blanks. A blank can't span
+    // lines, which is what lets edits re-parse only the line they touched.
+    static void parseLine(const QString &line, QStringList &texts, QList<QStringList> &blanks);
+};
+
+#endif // CLOZEEDIT_H
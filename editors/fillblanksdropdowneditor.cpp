@@ -14,6 +14,9 @@
 
 #include "fillblanksdropdowneditor.h"
 #include "../helpers.h"
+#include "../theme.h"
+#include "questionheader.h"
+#include "clozeedit.h"
 #include <QFileDialog>
 #include <QMessageBox>
 
@@ -22,32 +25,6 @@ FillBlanksDropdownEditor::FillBlanksDropdownEditor(QWidget *parent) : BaseQuesti
     auto mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(15);
 
-        // ... (rest of the constructor UI setup is the same) ...
-    
-    // 💖 ADD THIS SNIPPET FOR THE LESSON PDF SECTION 💖
-    auto lessonGroup = new QGroupBox("📚 Lesson PDF (Optional) 📚");
-    auto lessonLayout = new QVBoxLayout(lessonGroup);
-    auto lessonRowLayout = new QHBoxLayout();
-    
-    m_lessonPdfEdit = new QLineEdit();
-    m_lessonPdfEdit->setPlaceholderText("Select the PDF file for this lesson...");
-    
-    m_lessonPdfButton = new QPushButton("Browse 📁");
-    connect(m_lessonPdfButton, &QPushButton::clicked, this, [this]() {
-        QString filePath = QFileDialog::getOpenFileName(this, "💖 Select Lesson PDF File 💖", "", "PDF Files (*.pdf);;All Files (*)");
-        if (!filePath.isEmpty()) {
-            m_lessonPdfEdit->setText(filePath);
-        }
-    });
-
-    lessonRowLayout->addWidget(new QLabel("File:"));
-    lessonRowLayout->addWidget(m_lessonPdfEdit, 1);
-    lessonRowLayout->addWidget(m_lessonPdfButton);
-
-    lessonLayout->addLayout(lessonRowLayout);
-    mainLayout->addWidget(lessonGroup);
-    // 💖 END SNIPPET 💖
-
     // Question text section
     auto questionGroup = new QGroupBox("❓ Question Prompt ❓");
     auto questionLayout = new QVBoxLayout(questionGroup);
@@ -56,88 +33,31 @@ FillBlanksDropdownEditor::FillBlanksDropdownEditor(QWidget *parent) : BaseQuesti
     m_questionTextEdit->setPlaceholderText("Choose from the dropdowns, sweetie! ⬇️");
     questionLayout->addWidget(m_questionTextEdit);
 
-    mainLayout->addWidget(questionGroup);
-
-        // ✨ Our new hint section! So cute! ✨
-    auto hintGroup = new QGroupBox("💡 Hint (Optional) 💡");
-    auto hintLayout = new QVBoxLayout(hintGroup);
-    m_hintTextEdit = new QTextEdit();
-    m_hintTextEdit->setPlaceholderText("A little hint for your love... 💕");
-    m_hintTextEdit->setMaximumHeight(80); // Keep it smol
-    hintLayout->addWidget(m_hintTextEdit);
-    mainLayout->addWidget(hintGroup);
-
-
-    // Media section  
-    auto mediaGroup = new QGroupBox("🎬 Media (Optional) 🎬");
-    auto mediaLayout = new QVBoxLayout(mediaGroup);
-
-    auto mediaRowLayout = new QHBoxLayout();
-    m_mediaTypeCombo = new QComboBox();
-    // 💖 I've added 'Image' here so you can select it from the dropdown! 💖
-    m_mediaTypeCombo->addItems({"None", "Video", "Audio", "Image"});
-
-    m_mediaEdit = new QLineEdit();
-    m_mediaEdit->setPlaceholderText("Select media file path...");
-
-    auto browseMediaBtn = new QPushButton("Browse 📁");
-    connect(browseMediaBtn, &QPushButton::clicked, this, &FillBlanksDropdownEditor::browseMedia);
-
-    mediaRowLayout->addWidget(new QLabel("Type:"));
-    mediaRowLayout->addWidget(m_mediaTypeCombo);
-    mediaRowLayout->addWidget(new QLabel("File:"));
-    mediaRowLayout->addWidget(m_mediaEdit, 1);
-    mediaRowLayout->addWidget(browseMediaBtn);
+    // 💖 Lesson PDF, hint and media come with the shared header 💖
+    m_header = new QuestionHeader(questionGroup);
+    mainLayout->addWidget(m_header);
 
-    mediaLayout->addLayout(mediaRowLayout);
-    mainLayout->addWidget(mediaGroup);
+    // The whole sentence, dropdowns and all, in one box
+    auto clozeGroup = new QGroupBox("📝 Sentence with Dropdowns 📝");
+    auto clozeLayout = new QVBoxLayout(clozeGroup);
 
-    // Sentence parts section
-    auto partsGroup = new QGroupBox("📝 Sentence Parts 📝");
-    auto partsGroupLayout = new QVBoxLayout(partsGroup);
+    auto clozeLabel = new QLabel("💡 Put each dropdown's options in double brackets, split with |, and a * before the correct one, "
+                                 "like: Choose [[*cats|dogs]] please! Start with a | for an empty first option: [[|*cats|dogs]] "
+                                 "A \\ in front of * | [ or ] makes it plain text, and \\n is a line break.");
+    clozeLabel->setWordWrap(true);
+    Theme::setRole(clozeLabel, "tip");
+    clozeLayout->addWidget(clozeLabel);
 
-    auto partsLabel = new QLabel("💡 Create sentence parts with dropdowns between them (like: 'Choose ', ' and then ', ' from dropdowns.')");
-    partsLabel->setWordWrap(true);
-    partsLabel->setStyleSheet("font-style: italic; color: #8B008B;");
-    partsGroupLayout->addWidget(partsLabel);
+    m_clozeEdit = new ClozeEdit();
+    m_clozeEdit->setPlaceholderText("Choose [[|*option1|option2]] and then [[|*choice1|choice2]] from these cute dropdowns. ⬇️");
+    clozeLayout->addWidget(m_clozeEdit);
 
-    QScrollArea *partsScrollArea = new QScrollArea();
-    partsScrollArea->setWidgetResizable(true);
-    QWidget *partsScrollWidget = new QWidget();
-    m_partsLayout = new QVBoxLayout(partsScrollWidget);
-    partsScrollArea->setWidget(partsScrollWidget);
-
-    partsGroupLayout->addWidget(partsScrollArea);
-
-    auto addPartButton = new QPushButton("Add Sentence Part 📝");
-    connect(addPartButton, &QPushButton::clicked, this, &FillBlanksDropdownEditor::addSentencePart);
-    partsGroupLayout->addWidget(addPartButton);
-
-    mainLayout->addWidget(partsGroup);
-
-    // Dropdown blanks section
-    auto blanksGroup = new QGroupBox("⬇️ Dropdown Blanks ⬇️");
-    auto blanksGroupLayout = new QVBoxLayout(blanksGroup);
-
-    auto blanksLabel = new QLabel("💡 Configure the dropdown options and correct answers for each blank!");
-    blanksLabel->setWordWrap(true);
-    blanksLabel->setStyleSheet("font-style: italic; color: #8B008B;");
-    blanksGroupLayout->addWidget(blanksLabel);
-
-    QScrollArea *blanksScrollArea = new QScrollArea();
-    blanksScrollArea->setWidgetResizable(true);
-    QWidget *blanksScrollWidget = new QWidget();
-    m_blanksLayout = new QVBoxLayout(blanksScrollWidget);
-    blanksScrollArea->setWidget(blanksScrollWidget);
-
-    blanksGroupLayout->addWidget(blanksScrollArea);
-
-    auto addBlankButton = new QPushButton("Add Dropdown Blank ⬇️");
+    auto addBlankButton = new QPushButton("Make a Dropdown ⬇️");
     connect(addBlankButton, &QPushButton::clicked, this, &FillBlanksDropdownEditor::addBlank);
-    blanksGroupLayout->addWidget(addBlankButton);
+    clozeLayout->addWidget(addBlankButton);
 
     // 💖 We're giving this section a stretch factor of 1 so it takes up all the space! 💖
-    mainLayout->addWidget(blanksGroup, 1);
+    mainLayout->addWidget(clozeGroup, 1);
 
     // Initialize with defaults  
     m_currentQuestion["type"] = "fill_blanks_dropdown";
@@ -152,48 +72,19 @@ FillBlanksDropdownEditor::FillBlanksDropdownEditor(QWidget *parent) : BaseQuesti
     m_currentQuestion["answers"] = QJsonArray{"option1", "choice1"};
     m_currentQuestion["media"] = QJsonValue::Null;
 
-    refreshPartsUI();
-    refreshBlanksUI();
+    refreshClozeUI();
+
+    trackEdits(this);
 }
 
 void FillBlanksDropdownEditor::loadJson(const QJsonObject& question) 
 {
     m_currentQuestion = question;
+    m_header->loadJson(question);
 
     m_questionTextEdit->setText(question["question"].toString());
 
-        // ✨ Load the hint text! ✨
-    m_hintTextEdit->setText(question["hint"].toString());
-
-    // Load media
-    QJsonValue mediaValue = question["media"];
-    if (mediaValue.isNull()) {
-        m_mediaTypeCombo->setCurrentText("None");
-        m_mediaEdit->clear();
-    } else {
-        QJsonObject media = mediaValue.toObject();
-        if (media.contains("video")) {
-            m_mediaTypeCombo->setCurrentText("Video");
-            m_mediaEdit->setText(media["video"].toString());
-        } else if (media.contains("audio")) {
-            m_mediaTypeCombo->setCurrentText("Audio");  
-            m_mediaEdit->setText(media["audio"].toString());
-        // 💖 And a cute little check for our new 'Image' type! 💖
-        } else if (media.contains("image")) {
-            m_mediaTypeCombo->setCurrentText("Image");
-            m_mediaEdit->setText(media["image"].toString());
-        }
-    }
-
-        // 💖 ADDED: Load the PDF path! 💖
-    QJsonObject lessonObj = question["lesson"].toObject();
-    if (m_lessonPdfEdit) {
-        m_lessonPdfEdit->setText(lessonObj["pdf"].toString());
-    }
-
-
-    refreshPartsUI();
-    refreshBlanksUI();
+    refreshClozeUI();
 }
 
 QJsonObject FillBlanksDropdownEditor::getJson() 
@@ -201,255 +92,75 @@ QJsonObject FillBlanksDropdownEditor::getJson()
     m_currentQuestion["question"] = m_questionTextEdit->toPlainText();
     m_currentQuestion["type"] = "fill_blanks_dropdown";
 
-        // ✨ Save the hint text! ✨
-    QString hintText = m_hintTextEdit->toPlainText().trimmed();
-    if (!hintText.isEmpty()) {
-        m_currentQuestion["hint"] = hintText;
-    } else {
-        m_currentQuestion.remove("hint");
-    }
+    m_header->saveJson(m_currentQuestion);
 
-    // Handle media
-    QString mediaType = m_mediaTypeCombo->currentText();
-    QString mediaPath = m_mediaEdit->text().trimmed();
+    // Parts, options and answers all come out of the one cloze text.
+    QStringList parts;
+    QList<QStringList> blanks;
+    m_clozeEdit->cloze(parts, blanks);
 
-    if (mediaType == "None" || mediaPath.isEmpty()) {
-        m_currentQuestion["media"] = QJsonValue::Null;
-    } else {
-        QJsonObject media;
-        media[mediaType.toLower()] = mediaPath;
-        m_currentQuestion["media"] = media;
-    }
-
-    // Save sentence parts
     QJsonArray partsArray;
-    for (QWidget* widget : m_partsWidgets) {
-        QTextEdit* textEdit = widget->findChild<QTextEdit*>();
-        if (textEdit) {
-            partsArray.append(textEdit->toPlainText());
-        }
-    }
+    for (const QString &part : parts) partsArray.append(part);
     m_currentQuestion["sentence_parts"] = partsArray;
 
-    // Save dropdown options and answers
     QJsonArray optionsForBlanksArray;
     QJsonArray answersArray;
-
-    for (QWidget* widget : m_blanksWidgets) {
-        QTextEdit* optionsTextEdit = widget->findChildren<QTextEdit*>()[0]; // First is options
-        QComboBox* answerCombo = widget->findChild<QComboBox*>();
-
-        if (optionsTextEdit && answerCombo) {
-            // Parse options from text (one per line)
-            QString optionsText = optionsTextEdit->toPlainText().trimmed();
-            QStringList optionsList = optionsText.split("\n", Qt::SkipEmptyParts);
-
-            QJsonArray optionsForThisBlank;
-            for (const QString& option : optionsList) {
-                optionsForThisBlank.append(option.trimmed());
-            }
-            optionsForBlanksArray.append(optionsForThisBlank);
-
-            // Save the correct answer
-            answersArray.append(answerCombo->currentText());
+    for (const QStringList &blank : blanks) {
+        QJsonArray optionsForThisBlank;
+        QString correct;
+        QString firstOption;
+        for (QString option : blank) {
+            // Only a * that's still unescaped marks the right one.
+            option = option.trimmed();
+            const bool starred = option.startsWith('*');
+            option = ClozeEdit::unescape(starred ? option.mid(1).trimmed() : option);
+            if (starred && correct.isEmpty()) correct = option;
+            if (firstOption.isEmpty()) firstOption = option;
+            optionsForThisBlank.append(option);
         }
+        optionsForBlanksArray.append(optionsForThisBlank);
+
+        // No star? Then the first real option is the right one.
+        answersArray.append(correct.isEmpty() ? firstOption : correct);
     }
 
     m_currentQuestion["options_for_blanks"] = optionsForBlanksArray;
     m_currentQuestion["answers"] = answersArray;
 
-        // 💖 ADD THIS SNIPPET TO SAVE THE LESSON PDF 💖
-    // Handle lesson PDF
-    if (m_lessonPdfEdit) {
-        QString pdfPath = m_lessonPdfEdit->text().trimmed();
-        if (!pdfPath.isEmpty()) {
-            QJsonObject lessonObj;
-            lessonObj["pdf"] = pdfPath;
-            m_currentQuestion["lesson"] = lessonObj;
-        } else {
-            m_currentQuestion.remove("lesson");
-        }
-    }
-    // 💖 END SNIPPET 💖
-
-
     return m_currentQuestion;
 }
 
-void FillBlanksDropdownEditor::refreshPartsUI() 
-{
-    clearParts();
-
-    QJsonArray parts = m_currentQuestion["sentence_parts"].toArray();
-    for (int i = 0; i < parts.size(); ++i) {
-        QString partText = parts[i].toString();
-
-        QWidget* row = new QWidget();
-        auto layout = new QVBoxLayout(row);
-
-        // Header
-        auto headerLayout = new QHBoxLayout();
-        auto label = new QLabel(QString("📝 Part %1").arg(i + 1));
-        label->setStyleSheet("font-weight: bold; color: #8B008B;");
-
-        QPushButton* deleteButton = new QPushButton("Delete 🗑️");
-        connect(deleteButton, &QPushButton::clicked, [this, i](){
-            QJsonArray current = m_currentQuestion["sentence_parts"].toArray();
-            if (current.size() > 1) {
-                current.removeAt(i);
-                m_currentQuestion["sentence_parts"] = current;
-                refreshPartsUI();
-            }
-        });
-
-        headerLayout->addWidget(label);
-        headerLayout->addStretch();
-        headerLayout->addWidget(deleteButton);
-        layout->addLayout(headerLayout);
-
-        // Text input (using QTextEdit to support newlines)
-        QTextEdit* textEdit = new QTextEdit();
-        textEdit->setPlainText(partText);
-        textEdit->setPlaceholderText("Sentence part text (can include \\n for newlines)...");
-        layout->addWidget(textEdit);
-
-        m_partsLayout->addWidget(row);
-        m_partsWidgets.append(row);
-    }
-}
-
-void FillBlanksDropdownEditor::refreshBlanksUI() 
+void FillBlanksDropdownEditor::refreshClozeUI()
 {
-    clearBlanks();
+    QStringList parts;
+    for (const QJsonValue &part : m_currentQuestion["sentence_parts"].toArray()) parts.append(part.toString());
 
     QJsonArray optionsForBlanks = m_currentQuestion["options_for_blanks"].toArray();
     QJsonArray answers = m_currentQuestion["answers"].toArray();
 
+    QList<QStringList> blanks;
     for (int i = 0; i < optionsForBlanks.size(); ++i) {
-        QJsonArray optionsArray = optionsForBlanks[i].toArray();
-        QString correctAnswer = (i < answers.size()) ? answers[i].toString() : "";
-
-        QWidget* row = new QWidget();
-        row->setStyleSheet("QWidget { border: 1px solid #FF69B4; border-radius: 5px; margin: 2px; padding: 5px; }");
-        auto layout = new QVBoxLayout(row);
-
-        // Header
-        auto headerLayout = new QHBoxLayout();
-        auto label = new QLabel(QString("⬇️ Dropdown %1 ⬇️").arg(i + 1));
-        label->setStyleSheet("font-weight: bold; color: #8B008B;");
-
-        QPushButton* deleteButton = new QPushButton("Delete 🗑️");
-        connect(deleteButton, &QPushButton::clicked, [this, i](){
-            QJsonArray currentOpts = m_currentQuestion["options_for_blanks"].toArray();
-            QJsonArray currentAns = m_currentQuestion["answers"].toArray();
-
-            if (currentOpts.size() > 1) {
-                currentOpts.removeAt(i);
-                if (i < currentAns.size()) {
-                    currentAns.removeAt(i);
-                }
-                m_currentQuestion["options_for_blanks"] = currentOpts;
-                m_currentQuestion["answers"] = currentAns;
-                refreshBlanksUI();
+        const QString answer = i < answers.size() ? answers[i].toString() : QString();
+        QStringList options;
+        bool starred = false;
+        for (const QJsonValue &optVal : optionsForBlanks[i].toArray()) {
+            const QString option = optVal.toString().trimmed();
+            if (!starred && !answer.isEmpty() && option == answer.trimmed()) {
+                options.append('*' + ClozeEdit::escape(option));
+                starred = true;
+            } else {
+                options.append(ClozeEdit::escape(option));
             }
-        });
-
-        headerLayout->addWidget(label);
-        headerLayout->addStretch();
-        headerLayout->addWidget(deleteButton);
-        layout->addLayout(headerLayout);
-
-        // Options input  
-        auto optionsLabel = new QLabel("📝 Dropdown Options (one per line):");
-        optionsLabel->setStyleSheet("font-weight: bold;");
-        layout->addWidget(optionsLabel);
-
-        QTextEdit* optionsTextEdit = new QTextEdit();
-        QStringList optionsList;
-        for (const QJsonValue& optVal : optionsArray) {
-            optionsList.append(optVal.toString());
         }
-        optionsTextEdit->setPlainText(optionsList.join("\n"));
-        optionsTextEdit->setPlaceholderText(" \nOption 1\nOption 2\nOption 3");
-        layout->addWidget(optionsTextEdit);
-
-        // Correct answer selection
-        auto answerLayout = new QHBoxLayout();
-        answerLayout->addWidget(new QLabel("✅ Correct Answer:"));
-
-        QComboBox* answerCombo = new QComboBox();
-        answerCombo->setEditable(true);
-        for (const QString& option : optionsList) {
-            answerCombo->addItem(option);
-        }
-        answerCombo->setCurrentText(correctAnswer);
-
-        answerLayout->addWidget(answerCombo, 1);
-        layout->addLayout(answerLayout);
-
-        m_blanksLayout->addWidget(row);
-        m_blanksWidgets.append(row);
+        // An answer that isn't one of the options becomes one, so it isn't lost.
+        if (!starred && !answer.isEmpty()) options.append('*' + ClozeEdit::escape(answer.trimmed()));
+        blanks.append(options);
     }
-}
-
-void FillBlanksDropdownEditor::addSentencePart() 
-{
-    QJsonArray parts = m_currentQuestion["sentence_parts"].toArray();
-    parts.append("new part...");
-    m_currentQuestion["sentence_parts"] = parts;
-    refreshPartsUI();
-}
-
-void FillBlanksDropdownEditor::addBlank() 
-{
-    QJsonArray optionsForBlanks = m_currentQuestion["options_for_blanks"].toArray();
-    QJsonArray answers = m_currentQuestion["answers"].toArray();
-
-    optionsForBlanks.append(QJsonArray{" ", "New Option 1", "New Option 2"});
-    answers.append("New Option 1");
-
-    m_currentQuestion["options_for_blanks"] = optionsForBlanks;
-    m_currentQuestion["answers"] = answers;
-    refreshBlanksUI();
-}
 
-void FillBlanksDropdownEditor::clearParts()
-{
-    for (QWidget* widget : m_partsWidgets) {
-        m_partsLayout->removeWidget(widget);
-        widget->deleteLater();
-    }
-    m_partsWidgets.clear();
-}
-
-void FillBlanksDropdownEditor::clearBlanks()
-{
-    for (QWidget* widget : m_blanksWidgets) {
-        m_blanksLayout->removeWidget(widget);
-        widget->deleteLater();
-    }
-    m_blanksWidgets.clear();
+    m_clozeEdit->setCloze(parts, blanks);
 }
 
-void FillBlanksDropdownEditor::browseMedia()
+void FillBlanksDropdownEditor::addBlank()
 {
-    QString filter;
-    QString mediaType = m_mediaTypeCombo->currentText().toLower();
-
-    if (mediaType == "video") {
-        filter = "Video Files (*.mp4 *.avi *.mov *.mkv);;All Files (*)";
-    } else if (mediaType == "audio") {
-        filter = "Audio Files (*.mp3 *.wav *.ogg *.m4a);;All Files (*)";
-    } else if (mediaType == "image") {
-        filter = "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)";
-    } else {
-        return;
-    }
-
-    QString fileName = QFileDialog::getOpenFileName(this,
-        "💖 Select Cute Media File 💖", "", filter);
-
-    if (!fileName.isEmpty()) {
-        m_mediaEdit->setText(fileName);
-    }
+    m_clozeEdit->insertBlank("|*New Option 1|New Option 2");
 }
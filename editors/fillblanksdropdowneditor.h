@@ -15,6 +15,8 @@
 #include <QJsonObject>
 #include <QJsonArray>
 
+class ClozeEdit;
+
 class FillBlanksDropdownEditor : public BaseQuestionEditor
 {
     Q_OBJECT
@@ -25,31 +27,17 @@ public:
     QJsonObject getJson() override;
 
 private slots:
-    void addSentencePart();
     void addBlank();
-    void browseMedia();
 
 private:
-    void refreshPartsUI();
-    void refreshBlanksUI();
-    void clearParts();
-    void clearBlanks();
+    void refreshClozeUI();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
-    QVBoxLayout* m_partsLayout;
-    QVBoxLayout* m_blanksLayout;
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
+    ClozeEdit* m_clozeEdit;
 
     // Data storage
     QJsonObject m_currentQuestion;
-    QList<QWidget*> m_partsWidgets;
-    QList<QWidget*> m_blanksWidgets;
 };
 
 #endif // FILLBLANKSDROPDOWNEDITOR_H
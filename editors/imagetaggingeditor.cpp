@@ -9,6 +9,8 @@
 
 #include "imagetaggingeditor.h"
 #include "../helpers.h" 
+#include "../theme.h"
+#include "questionheader.h"
 #include <QFileDialog>
 #include <QMessageBox>
 
@@ -17,32 +19,6 @@ ImageTaggingEditor::ImageTaggingEditor(QWidget *parent) : BaseQuestionEditor(par
     auto mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(15);
 
-        // ... (rest of the constructor UI setup is the same) ...
-    
-    // 💖 ADD THIS SNIPPET FOR THE LESSON PDF SECTION 💖
-    auto lessonGroup = new QGroupBox("📚 Lesson PDF (Optional) 📚");
-    auto lessonLayout = new QVBoxLayout(lessonGroup);
-    auto lessonRowLayout = new QHBoxLayout();
-    
-    m_lessonPdfEdit = new QLineEdit();
-    m_lessonPdfEdit->setPlaceholderText("Select the PDF file for this lesson...");
-    
-    m_lessonPdfButton = new QPushButton("Browse 📁");
-    connect(m_lessonPdfButton, &QPushButton::clicked, this, [this]() {
-        QString filePath = QFileDialog::getOpenFileName(this, "💖 Select Lesson PDF File 💖", "", "PDF Files (*.pdf);;All Files (*)");
-        if (!filePath.isEmpty()) {
-            m_lessonPdfEdit->setText(filePath);
-        }
-    });
-
-    lessonRowLayout->addWidget(new QLabel("File:"));
-    lessonRowLayout->addWidget(m_lessonPdfEdit, 1);
-    lessonRowLayout->addWidget(m_lessonPdfButton);
-
-    lessonLayout->addLayout(lessonRowLayout);
-    mainLayout->addWidget(lessonGroup);
-    // 💖 END SNIPPET 💖
-
     // Question text section
     auto questionGroup = new QGroupBox("❓ Question Prompt ❓");
     auto questionLayout = new QVBoxLayout(questionGroup);
@@ -51,41 +27,10 @@ ImageTaggingEditor::ImageTaggingEditor(QWidget *parent) : BaseQuestionEditor(par
     m_questionTextEdit->setPlaceholderText("Tag the cute image! 💖");
     questionLayout->addWidget(m_questionTextEdit);
 
-    mainLayout->addWidget(questionGroup);
-
-        // ✨ Our new hint section! So cute! ✨
-    auto hintGroup = new QGroupBox("💡 Hint (Optional) 💡");
-    auto hintLayout = new QVBoxLayout(hintGroup);
-    m_hintTextEdit = new QTextEdit();
-    m_hintTextEdit->setPlaceholderText("A little hint for your love... 💕");
-    m_hintTextEdit->setMaximumHeight(80); // Keep it smol
-    hintLayout->addWidget(m_hintTextEdit);
-    mainLayout->addWidget(hintGroup);
-
-
-    // Media section  
-    // 💖 I've added a media section for extra media, as you suggested! 💖
-    auto extraMediaGroup = new QGroupBox("🎬 Extra Media (Optional) 🎬");
-    auto extraMediaLayout = new QVBoxLayout(extraMediaGroup);
-
-    auto extraMediaRowLayout = new QHBoxLayout();
-    m_mediaTypeCombo = new QComboBox();
-    m_mediaTypeCombo->addItems({"None", "Video", "Audio", "Image"});
-
-    m_mediaEdit = new QLineEdit();
-    m_mediaEdit->setPlaceholderText("Select media file path...");
-
-    auto browseMediaBtn = new QPushButton("Browse 📁");
-    connect(browseMediaBtn, &QPushButton::clicked, this, &ImageTaggingEditor::browseMedia);
-
-    extraMediaRowLayout->addWidget(new QLabel("Type:"));
-    extraMediaRowLayout->addWidget(m_mediaTypeCombo);
-    extraMediaRowLayout->addWidget(new QLabel("File:"));
-    extraMediaRowLayout->addWidget(m_mediaEdit, 1);
-    extraMediaRowLayout->addWidget(browseMediaBtn);
-
-    extraMediaLayout->addLayout(extraMediaRowLayout);
-    mainLayout->addWidget(extraMediaGroup);
+    // 💖 Lesson PDF, hint and media come with the shared header. Our "media"
+    // is the image being tagged, so the header's extra media goes in optional_media 💖
+    m_header = new QuestionHeader(questionGroup, "optional_media");
+    mainLayout->addWidget(m_header);
 
     // Main image configuration
     auto mainImageGroup = new QGroupBox("🖼️ Main Image Configuration 🖼️");
@@ -118,7 +63,7 @@ ImageTaggingEditor::ImageTaggingEditor(QWidget *parent) : BaseQuestionEditor(par
     auto mainTagsGroupLayout = new QVBoxLayout(mainTagsGroup);
 
     auto tagsLabel = new QLabel("💡 Configure draggable tags and their coordinates for the main image!");
-    tagsLabel->setStyleSheet("font-style: italic; color: #8B008B;");
+    Theme::setRole(tagsLabel, "tip");
     mainTagsGroupLayout->addWidget(tagsLabel);
 
     QScrollArea *mainTagsScrollArea = new QScrollArea();
@@ -142,7 +87,7 @@ ImageTaggingEditor::ImageTaggingEditor(QWidget *parent) : BaseQuestionEditor(par
     
     auto altLabel = new QLabel("💡 Add alternative images with their own tag coordinates! Super advanced! ✨");
     altLabel->setWordWrap(true);
-    altLabel->setStyleSheet("font-style: italic; color: #8B008B;");
+    Theme::setRole(altLabel, "tip");
     alternativesGroupLayout->addWidget(altLabel);
     
     QScrollArea *alternativesScrollArea = new QScrollArea();
@@ -178,20 +123,14 @@ ImageTaggingEditor::ImageTaggingEditor(QWidget *parent) : BaseQuestionEditor(par
     m_currentQuestion["alternatives"] = QJsonArray();
 
     refreshUI();
+
+    trackEdits(this);
 }
 
 void ImageTaggingEditor::loadJson(const QJsonObject& question) 
 {
     m_currentQuestion = question;
-    // ✨ Load the hint text! uwu ✨
-    m_hintTextEdit->setText(question["hint"].toString());
-
-        // 💖 ADDED: Load the PDF path! 💖
-    QJsonObject lessonObj = question["lesson"].toObject();
-    if (m_lessonPdfEdit) {
-        m_lessonPdfEdit->setText(lessonObj["pdf"].toString());
-    }
-
+    m_header->loadJson(question);
 
     refreshUI();
 }
@@ -201,13 +140,7 @@ QJsonObject ImageTaggingEditor::getJson()
     m_currentQuestion["question"] = m_questionTextEdit->toPlainText();
     m_currentQuestion["type"] = "image_tagging";
 
-        // ✨ Save the hint text! ✨
-    QString hintText = m_hintTextEdit->toPlainText().trimmed();
-    if (!hintText.isEmpty()) {
-        m_currentQuestion["hint"] = hintText;
-    } else {
-        m_currentQuestion.remove("hint");
-    }
+    m_header->saveJson(m_currentQuestion);
 
     // Save main image info
     QString mainImagePath = m_mainImageEdit->text().trimmed();
@@ -224,10 +157,10 @@ QJsonObject ImageTaggingEditor::getJson()
     QJsonObject answerObject;
 
     for (QWidget* widget : m_mainTagWidgets) {
-        QLineEdit* idEdit = widget->findChildren<QLineEdit*>()[0];
-        QLineEdit* labelEdit = widget->findChildren<QLineEdit*>()[1];
-        QLineEdit* xEdit = widget->findChildren<QLineEdit*>()[2];
-        QLineEdit* yEdit = widget->findChildren<QLineEdit*>()[3];
+        QLineEdit* idEdit = widget->findChild<QLineEdit*>("idEdit");
+        QLineEdit* labelEdit = widget->findChild<QLineEdit*>("labelEdit");
+        QLineEdit* xEdit = widget->findChild<QLineEdit*>("xEdit");
+        QLineEdit* yEdit = widget->findChild<QLineEdit*>("yEdit");
 
         if (idEdit && labelEdit && xEdit && yEdit) {
             QString id = idEdit->text().trimmed();
@@ -269,11 +202,11 @@ QJsonObject ImageTaggingEditor::getJson()
         // Save alternative coordinates
         QJsonObject altAnswer;
         for (QWidget* widget : alt.tagWidgets) {
-            if (widget->findChildren<QLineEdit*>().size() >= 4) {
-                QLineEdit* idEdit = widget->findChildren<QLineEdit*>()[0];
-                QLineEdit* xEdit = widget->findChildren<QLineEdit*>()[2];
-                QLineEdit* yEdit = widget->findChildren<QLineEdit*>()[3];
-
+            // By name: the hidden id edit isn't first among the row's children.
+            QLineEdit* idEdit = widget->findChild<QLineEdit*>("idEdit");
+            QLineEdit* xEdit = widget->findChild<QLineEdit*>("xEdit");
+            QLineEdit* yEdit = widget->findChild<QLineEdit*>("yEdit");
+            if (idEdit && xEdit && yEdit) {
                 QString id = idEdit->text().trimmed();
                 int x = xEdit->text().toInt();
                 int y = yEdit->text().toInt();
@@ -288,33 +221,6 @@ QJsonObject ImageTaggingEditor::getJson()
 
     m_currentQuestion["alternatives"] = alternativesArray;
 
-    // Handle optional media
-    QString mediaType = m_mediaTypeCombo->currentText();
-    QString mediaPath = m_mediaEdit->text().trimmed();
-
-    if (mediaType == "None" || mediaPath.isEmpty()) {
-        m_currentQuestion["optional_media"] = QJsonValue::Null;
-    } else {
-        QJsonObject media;
-        media[mediaType.toLower()] = mediaPath;
-        m_currentQuestion["optional_media"] = media;
-    }
-
-        // 💖 ADD THIS SNIPPET TO SAVE THE LESSON PDF 💖
-    // Handle lesson PDF
-    if (m_lessonPdfEdit) {
-        QString pdfPath = m_lessonPdfEdit->text().trimmed();
-        if (!pdfPath.isEmpty()) {
-            QJsonObject lessonObj;
-            lessonObj["pdf"] = pdfPath;
-            m_currentQuestion["lesson"] = lessonObj;
-        } else {
-            m_currentQuestion.remove("lesson");
-        }
-    }
-    // 💖 END SNIPPET 💖
-
-
     return m_currentQuestion;
 }
 
@@ -328,24 +234,6 @@ void ImageTaggingEditor::refreshUI()
     m_mainImageEdit->setText(media["image"].toString());
     m_buttonLabelEdit->setText(m_currentQuestion["button_label"].toString());
     
-    // Load optional media
-    QJsonValue optionalMediaValue = m_currentQuestion["optional_media"];
-    if (optionalMediaValue.isNull()) {
-        m_mediaTypeCombo->setCurrentText("None");
-        m_mediaEdit->clear();
-    } else {
-        QJsonObject media = optionalMediaValue.toObject();
-        if (media.contains("video")) {
-            m_mediaTypeCombo->setCurrentText("Video");
-            m_mediaEdit->setText(media["video"].toString());
-        } else if (media.contains("audio")) {
-            m_mediaTypeCombo->setCurrentText("Audio");
-            m_mediaEdit->setText(media["audio"].toString());
-        } else if (media.contains("image")) {
-            m_mediaTypeCombo->setCurrentText("Image");
-            m_mediaEdit->setText(media["image"].toString());
-        }
-    }
 
     refreshMainTagsUI();
     refreshAlternativesUI();
@@ -361,220 +249,239 @@ void ImageTaggingEditor::refreshMainTagsUI()
     for (const QJsonValue& tagValue : tags) {
         QJsonObject tag = tagValue.toObject();
         QString id = tag["id"].toString();
-        QString label = tag["label"].toString();
 
         QJsonArray coords = answer[id].toArray();
         int x = coords.size() > 0 ? coords[0].toInt() : 0;
         int y = coords.size() > 1 ? coords[1].toInt() : 0;
 
-        QWidget* row = new QWidget();
-        auto layout = new QHBoxLayout(row);
-
-        // Tag ID
-        layout->addWidget(new QLabel("ID:"));
-        QLineEdit* idEdit = new QLineEdit(id);
-        idEdit->setMaximumWidth(80);
-        layout->addWidget(idEdit);
-
-        // Tag Label
-        layout->addWidget(new QLabel("Label:"));
-        QLineEdit* labelEdit = new QLineEdit(label);
-        labelEdit->setMinimumWidth(120);
-        layout->addWidget(labelEdit);
-
-        // Coordinates
-        layout->addWidget(new QLabel("X:"));
-        QLineEdit* xEdit = new QLineEdit(QString::number(x));
-        xEdit->setMaximumWidth(60);
-        layout->addWidget(xEdit);
-
-        layout->addWidget(new QLabel("Y:"));
-        QLineEdit* yEdit = new QLineEdit(QString::number(y));
-        yEdit->setMaximumWidth(60);
-        layout->addWidget(yEdit);
-
-        // Delete button
-        QPushButton* deleteBtn = new QPushButton("🗑️");
-        connect(deleteBtn, &QPushButton::clicked, [this, row](){
-            if (m_mainTagWidgets.size() > 1) {
-                m_mainTagsLayout->removeWidget(row);
-                m_mainTagWidgets.removeOne(row);
-                row->deleteLater();
-            }
-        });
-        layout->addWidget(deleteBtn);
+        appendMainTagRow(id, tag["label"].toString(), x, y);
+    }
+}
+
+void ImageTaggingEditor::appendMainTagRow(const QString &id, const QString &label, int x, int y)
+{
+    QWidget* row = new QWidget();
+    auto layout = new QHBoxLayout(row);
+
+    // Tag ID
+    layout->addWidget(new QLabel("ID:"));
+    QLineEdit* idEdit = new QLineEdit(id);
+    idEdit->setObjectName("idEdit");
+    idEdit->setMaximumWidth(80);
+    layout->addWidget(idEdit);
+
+    // Tag Label
+    layout->addWidget(new QLabel("Label:"));
+    QLineEdit* labelEdit = new QLineEdit(label);
+    labelEdit->setObjectName("labelEdit");
+    labelEdit->setMinimumWidth(120);
+    layout->addWidget(labelEdit);
+
+    // Coordinates
+    layout->addWidget(new QLabel("X:"));
+    QLineEdit* xEdit = new QLineEdit(QString::number(x));
+    xEdit->setObjectName("xEdit");
+    xEdit->setMaximumWidth(60);
+    layout->addWidget(xEdit);
+
+    layout->addWidget(new QLabel("Y:"));
+    QLineEdit* yEdit = new QLineEdit(QString::number(y));
+    yEdit->setObjectName("yEdit");
+    yEdit->setMaximumWidth(60);
+    layout->addWidget(yEdit);
+
+    // Every alternative lists the same tags, so renames show up there too.
+    auto syncAlternatives = [this, row](){
+        syncAlternativeTagRows(m_mainTagWidgets.indexOf(row));
+    };
+    connect(idEdit, &QLineEdit::textChanged, this, syncAlternatives);
+    connect(labelEdit, &QLineEdit::textChanged, this, syncAlternatives);
+
+    // Delete button
+    QPushButton* deleteBtn = new QPushButton("🗑️");
+    connect(deleteBtn, &QPushButton::clicked, this, [this, row](){
+        if (m_mainTagWidgets.size() <= 1) return;
+        const int index = removeRow(m_mainTagWidgets, m_mainTagsLayout, row);
+        if (index < 0) return;
+        for (AlternativeWidgets &alt : m_alternativeWidgets) {
+            if (index < alt.tagWidgets.size()) removeRow(alt.tagWidgets, alt.tagsLayout, alt.tagWidgets[index]);
+        }
+    });
+    layout->addWidget(deleteBtn);
 
-        m_mainTagsLayout->addWidget(row);
-        m_mainTagWidgets.append(row);
+    m_mainTagsLayout->addWidget(row);
+    trackEdits(row);
+    m_mainTagWidgets.append(row);
+}
+
+void ImageTaggingEditor::syncAlternativeTagRows(int index)
+{
+    if (index < 0 || index >= m_mainTagWidgets.size()) return;
+    const QString id = m_mainTagWidgets[index]->findChild<QLineEdit*>("idEdit")->text();
+    const QString label = m_mainTagWidgets[index]->findChild<QLineEdit*>("labelEdit")->text();
+    for (const AlternativeWidgets &alt : std::as_const(m_alternativeWidgets)) {
+        QWidget *coordRow = alt.tagWidgets.value(index);
+        if (!coordRow) continue;
+        coordRow->findChild<QLabel*>("tagLabel")->setText(QString("%1 (%2):").arg(label).arg(id));
+        coordRow->findChild<QLineEdit*>("idEdit")->setText(id);
+        coordRow->findChild<QLineEdit*>("labelEdit")->setText(label);
     }
 }
 
+void ImageTaggingEditor::appendAlternativeTagRow(AlternativeWidgets &alt, const QString &id, const QString &label, int x, int y)
+{
+    QWidget* coordRow = new QWidget();
+    auto coordRowLayout = new QHBoxLayout(coordRow);
+
+    auto tagLabel = new QLabel(QString("%1 (%2):").arg(label).arg(id));
+    tagLabel->setObjectName("tagLabel");
+    coordRowLayout->addWidget(tagLabel);
+
+    QLineEdit* hiddenIdEdit = new QLineEdit(id);
+    hiddenIdEdit->setObjectName("idEdit");
+    hiddenIdEdit->setVisible(false);
+    QLineEdit* hiddenLabelEdit = new QLineEdit(label);
+    hiddenLabelEdit->setObjectName("labelEdit");
+    hiddenLabelEdit->setVisible(false);
+
+    coordRowLayout->addWidget(new QLabel("X:"));
+    QLineEdit* xEdit = new QLineEdit(QString::number(x));
+    xEdit->setObjectName("xEdit");
+    xEdit->setMaximumWidth(60);
+    coordRowLayout->addWidget(xEdit);
+
+    coordRowLayout->addWidget(new QLabel("Y:"));
+    QLineEdit* yEdit = new QLineEdit(QString::number(y));
+    yEdit->setObjectName("yEdit");
+    yEdit->setMaximumWidth(60);
+    coordRowLayout->addWidget(yEdit);
+
+    coordRowLayout->addWidget(hiddenIdEdit);
+    coordRowLayout->addWidget(hiddenLabelEdit);
+    coordRowLayout->addStretch();
+
+    alt.tagsLayout->addWidget(coordRow);
+    trackEdits(coordRow);
+    alt.tagWidgets.append(coordRow);
+}
+
 void ImageTaggingEditor::refreshAlternativesUI() 
 {
     clearAlternatives();
 
     QJsonArray alternatives = m_currentQuestion["alternatives"].toArray();
+    for (const QJsonValue &value : alternatives) {
+        QJsonObject alt = value.toObject();
+        appendAlternative(alt["media"].toObject()["image"].toString(), alt["button_label"].toString(),
+                          alt["answer"].toObject());
+    }
+}
 
-    for (int altIndex = 0; altIndex < alternatives.size(); ++altIndex) {
-        QJsonObject alt = alternatives[altIndex].toObject();
-
-        // Create alternative container
-        QWidget* altContainer = new QWidget();
-        altContainer->setStyleSheet("QWidget { border: 2px solid #FF69B4; border-radius: 10px; margin: 5px; padding: 10px; }");
-        auto altLayout = new QVBoxLayout(altContainer);
-
-        // Alternative header
-        auto headerLayout = new QHBoxLayout();
-        auto altLabel = new QLabel(QString("🌈 Alternative %1 🌈").arg(altIndex + 1));
-        altLabel->setStyleSheet("font-weight: bold; font-size: 14px; color: #8B008B;");
-
-        QPushButton* deleteAltBtn = new QPushButton("Delete Alternative 🗑️");
-        connect(deleteAltBtn, &QPushButton::clicked, [this, altIndex](){
-            // Remove from JSON and refresh
-            QJsonArray current = m_currentQuestion["alternatives"].toArray();
-            current.removeAt(altIndex);
-            m_currentQuestion["alternatives"] = current;
-            refreshAlternativesUI();
-        });
-
-        headerLayout->addWidget(altLabel);
-        headerLayout->addStretch();
-        headerLayout->addWidget(deleteAltBtn);
-        altLayout->addLayout(headerLayout);
-
-        // Alternative image and button label
-        auto altConfigLayout = new QHBoxLayout();
-
-        altConfigLayout->addWidget(new QLabel("Image:"));
-        QLineEdit* altImageEdit = new QLineEdit();
-        QJsonObject altMedia = alt["media"].toObject();
-        altImageEdit->setText(altMedia["image"].toString());
-        altImageEdit->setPlaceholderText("Alternative image path...");
-
-        QPushButton* browseAltBtn = new QPushButton("Browse 📁");
-        connect(browseAltBtn, &QPushButton::clicked, [this, altImageEdit](){
-            browseAlternativeImage(altImageEdit);
-        });
-
-        altConfigLayout->addWidget(altImageEdit, 1);
-        altConfigLayout->addWidget(browseAltBtn);
-
-        altConfigLayout->addWidget(new QLabel("Button:"));
-        QLineEdit* altButtonEdit = new QLineEdit();
-        altButtonEdit->setText(alt["button_label"].toString());
-        altButtonEdit->setPlaceholderText("Button label...");
-        altButtonEdit->setMaximumWidth(150);
-        altConfigLayout->addWidget(altButtonEdit);
-
-        altLayout->addLayout(altConfigLayout);
-
-        // Alternative coordinates section
-        auto coordsLabel = new QLabel("🎯 Tag Coordinates for this Alternative:");
-        coordsLabel->setStyleSheet("font-weight: bold; margin-top: 10px;");
-        altLayout->addWidget(coordsLabel);
-
-        QWidget* coordsWidget = new QWidget();
-        QVBoxLayout* coordsLayout = new QVBoxLayout(coordsWidget);
-
-        // Create coordinate inputs for each main tag
-        QJsonObject altAnswer = alt["answer"].toObject();
-        QJsonArray mainTags = m_currentQuestion["tags"].toArray();
-        QList<QWidget*> altTagWidgets;
-
-        for (const QJsonValue& tagValue : mainTags) {
-            QJsonObject tag = tagValue.toObject();
-            QString id = tag["id"].toString();
-            QString label = tag["label"].toString();
-
-            QJsonArray coords = altAnswer[id].toArray();
-            int x = coords.size() > 0 ? coords[0].toInt() : 0;
-            int y = coords.size() > 1 ? coords[1].toInt() : 0;
-
-            QWidget* coordRow = new QWidget();
-            auto coordRowLayout = new QHBoxLayout(coordRow);
-
-            coordRowLayout->addWidget(new QLabel(QString("%1 (%2):").arg(label).arg(id)));
-
-            QLineEdit* hiddenIdEdit = new QLineEdit(id);
-            hiddenIdEdit->setVisible(false);
-            QLineEdit* hiddenLabelEdit = new QLineEdit(label);
-            hiddenLabelEdit->setVisible(false);
-
-            coordRowLayout->addWidget(new QLabel("X:"));
-            QLineEdit* xEdit = new QLineEdit(QString::number(x));
-            xEdit->setMaximumWidth(60);
-            coordRowLayout->addWidget(xEdit);
-
-            coordRowLayout->addWidget(new QLabel("Y:"));
-            QLineEdit* yEdit = new QLineEdit(QString::number(y));
-            yEdit->setMaximumWidth(60);
-            coordRowLayout->addWidget(yEdit);
-
-            coordRowLayout->addWidget(hiddenIdEdit);
-            coordRowLayout->addWidget(hiddenLabelEdit);
-            coordRowLayout->addStretch();
-
-            coordsLayout->addWidget(coordRow);
-            altTagWidgets.append(coordRow);
+void ImageTaggingEditor::appendAlternative(const QString &imagePath, const QString &buttonLabel, const QJsonObject &altAnswer)
+{
+    // Create alternative container
+    QWidget* altContainer = new QWidget();
+    Theme::setRole(altContainer, "card");
+    auto altLayout = new QVBoxLayout(altContainer);
+
+    // Alternative header
+    auto headerLayout = new QHBoxLayout();
+    auto altLabel = new QLabel(QString("🌈 Alternative %1 🌈").arg(m_alternativeWidgets.size() + 1));
+    altLabel->setObjectName("rowNumber");
+    Theme::setRole(altLabel, "cardTitle");
+
+    QPushButton* deleteAltBtn = new QPushButton("Delete Alternative 🗑️");
+    connect(deleteAltBtn, &QPushButton::clicked, this, [this, altContainer](){
+        int index = 0;
+        while (index < m_alternativeWidgets.size() && m_alternativeWidgets[index].container != altContainer) ++index;
+        if (index == m_alternativeWidgets.size()) return;
+        m_alternativeWidgets.removeAt(index);
+        m_alternativesLayout->removeWidget(altContainer);
+        altContainer->deleteLater();
+        for (int i = index; i < m_alternativeWidgets.size(); ++i) {
+            if (QLabel *label = rowNumberLabel(m_alternativeWidgets[i].container))
+                label->setText(QString("🌈 Alternative %1 🌈").arg(i + 1));
         }
+    });
 
-        altLayout->addWidget(coordsWidget);
+    headerLayout->addWidget(altLabel);
+    headerLayout->addStretch();
+    headerLayout->addWidget(deleteAltBtn);
+    altLayout->addLayout(headerLayout);
 
-        // Store alternative widgets
-        AlternativeWidgets altWidgets;
-        altWidgets.container = altContainer;
-        altWidgets.imageEdit = altImageEdit;
-        altWidgets.buttonLabelEdit = altButtonEdit;
-        altWidgets.tagsLayout = coordsLayout;
-        altWidgets.tagWidgets = altTagWidgets;
+    // Alternative image and button label
+    auto altConfigLayout = new QHBoxLayout();
 
-        m_alternativeWidgets.append(altWidgets);
-        m_alternativesLayout->addWidget(altContainer);
+    altConfigLayout->addWidget(new QLabel("Image:"));
+    QLineEdit* altImageEdit = new QLineEdit();
+    altImageEdit->setText(imagePath);
+    altImageEdit->setPlaceholderText("Alternative image path...");
+
+    QPushButton* browseAltBtn = new QPushButton("Browse 📁");
+    connect(browseAltBtn, &QPushButton::clicked, [this, altImageEdit](){
+        browseAlternativeImage(altImageEdit);
+    });
+
+    altConfigLayout->addWidget(altImageEdit, 1);
+    altConfigLayout->addWidget(browseAltBtn);
+
+    altConfigLayout->addWidget(new QLabel("Button:"));
+    QLineEdit* altButtonEdit = new QLineEdit();
+    altButtonEdit->setText(buttonLabel);
+    altButtonEdit->setPlaceholderText("Button label...");
+    altButtonEdit->setMaximumWidth(150);
+    altConfigLayout->addWidget(altButtonEdit);
+
+    altLayout->addLayout(altConfigLayout);
+
+    // Alternative coordinates section
+    auto coordsLabel = new QLabel("🎯 Tag Coordinates for this Alternative:");
+    Theme::setRole(coordsLabel, "subheading");
+    altLayout->addWidget(coordsLabel);
+
+    QWidget* coordsWidget = new QWidget();
+    QVBoxLayout* coordsLayout = new QVBoxLayout(coordsWidget);
+    altLayout->addWidget(coordsWidget);
+
+    AlternativeWidgets altWidgets;
+    altWidgets.container = altContainer;
+    altWidgets.imageEdit = altImageEdit;
+    altWidgets.buttonLabelEdit = altButtonEdit;
+    altWidgets.tagsLayout = coordsLayout;
+
+    // One coordinate row per main tag, in the same order
+    for (QWidget *tagRow : std::as_const(m_mainTagWidgets)) {
+        const QString id = tagRow->findChild<QLineEdit*>("idEdit")->text().trimmed();
+        const QString label = tagRow->findChild<QLineEdit*>("labelEdit")->text().trimmed();
+        QJsonArray coords = altAnswer[id].toArray();
+        int x = coords.size() > 0 ? coords[0].toInt() : 0;
+        int y = coords.size() > 1 ? coords[1].toInt() : 0;
+        appendAlternativeTagRow(altWidgets, id, label, x, y);
     }
+
+    m_alternativeWidgets.append(altWidgets);
+    m_alternativesLayout->addWidget(altContainer);
+    trackEdits(altContainer);
 }
 
 void ImageTaggingEditor::addTag() 
 {
-    QJsonArray tags = m_currentQuestion["tags"].toArray();
-    QString newId = QString("tag%1").arg(tags.size() + 1);
-
-    QJsonObject newTag;
-    newTag["id"] = newId;
-    newTag["label"] = "New Tag";
-    tags.append(newTag);
-
-    m_currentQuestion["tags"] = tags;
-
-    // Add default coordinates
-    QJsonObject answer = m_currentQuestion["answer"].toObject();
-    answer[newId] = QJsonArray{100, 100};
-    m_currentQuestion["answer"] = answer;
-
-    refreshUI(); // Refresh everything to update alternatives too
+    QString newId = QString("tag%1").arg(m_mainTagWidgets.size() + 1);
+    appendMainTagRow(newId, "New Tag", 100, 100);
+    // Alternatives get the new tag too, at the same default spot
+    for (AlternativeWidgets &alt : m_alternativeWidgets) {
+        appendAlternativeTagRow(alt, newId, "New Tag", 100, 100);
+    }
 }
 
 void ImageTaggingEditor::addAlternative() 
 {
-    QJsonArray alternatives = m_currentQuestion["alternatives"].toArray();
-
-    QJsonObject newAlt;
-    newAlt["media"] = QJsonObject{{"image", ""}};
-    newAlt["button_label"] = "New Alternative";
-    newAlt["tags"] = m_currentQuestion["tags"]; // Same tags as main
-
-    // Initialize with default coordinates for all tags
+    // Default coordinates for every tag
     QJsonObject altAnswer;
-    QJsonArray tags = m_currentQuestion["tags"].toArray();
-    for (const QJsonValue& tagValue : tags) {
-        QString id = tagValue.toObject()["id"].toString();
-        altAnswer[id] = QJsonArray{100, 100};
+    for (QWidget *tagRow : std::as_const(m_mainTagWidgets)) {
+        altAnswer[tagRow->findChild<QLineEdit*>("idEdit")->text().trimmed()] = QJsonArray{100, 100};
     }
-    newAlt["answer"] = altAnswer;
-
-    alternatives.append(newAlt);
-    m_currentQuestion["alternatives"] = alternatives;
-
-    refreshAlternativesUI();
+    appendAlternative(QString(), "New Alternative", altAnswer);
 }
 
 void ImageTaggingEditor::clearMainTags()
@@ -616,26 +523,3 @@ void ImageTaggingEditor::browseAlternativeImage(QLineEdit* imageEdit)
         imageEdit->setText(fileName);
     }
 }
-
-void ImageTaggingEditor::browseMedia()
-{
-    QString filter;
-    QString mediaType = m_mediaTypeCombo->currentText().toLower();
-
-    if (mediaType == "video") {
-        filter = "Video Files (*.mp4 *.avi *.mov *.mkv);;All Files (*)";
-    } else if (mediaType == "audio") {
-        filter = "Audio Files (*.mp3 *.wav *.ogg *.m4a);;All Files (*)";
-    } else if (mediaType == "image") {
-        filter = "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)";
-    } else {
-        return;
-    }
-
-    QString fileName = QFileDialog::getOpenFileName(this,
-        "💖 Select Cute Media File 💖", "", filter);
-
-    if (!fileName.isEmpty()) {
-        m_mediaEdit->setText(fileName);
-    }
-}
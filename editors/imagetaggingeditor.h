@@ -30,8 +30,6 @@ private slots:
     void addAlternative();
     void browseMainImage();
     void browseAlternativeImage(QLineEdit* imageEdit);
-    // 💖 Our new slot to browse for optional media! 💖
-    void browseMedia();
 
 private:
     void refreshUI();
@@ -39,6 +37,9 @@ private:
     void refreshAlternativesUI();
     void clearMainTags();
     void clearAlternatives();
+    void appendMainTagRow(const QString &id, const QString &label, int x, int y);
+    void appendAlternative(const QString &imagePath, const QString &buttonLabel, const QJsonObject &altAnswer);
+    void syncAlternativeTagRows(int index);
 
     // UI Elements for main image
     QTextEdit* m_questionTextEdit;
@@ -47,13 +48,6 @@ private:
     QVBoxLayout* m_mainTagsLayout;
     QVBoxLayout* m_alternativesLayout;
     
-    // 💖 Our new UI elements for optional media! 💖
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
 
     // Data storage
     QJsonObject m_currentQuestion;
@@ -70,6 +64,7 @@ private:
         QList<QWidget*> tagWidgets;
     };
     QList<AlternativeWidgets> m_alternativeWidgets;
+    void appendAlternativeTagRow(AlternativeWidgets &alt, const QString &id, const QString &label, int x, int y);
 };
 
 #endif // IMAGETAGGINGEDITOR_H
@@ -0,0 +1,420 @@
+#include "itemtable.h"
+#include "../imageloader.h"
+
+#include <QComboBox>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLineEdit>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QStringListModel>
+#include <QTableView>
+#include <QVBoxLayout>
+#include <algorithm>
+#include <functional>
+
+ItemTableModel::ItemTableModel(const QList<ItemColumn> &columns, QObject *parent)
+    : QAbstractTableModel(parent),
+      m_columns(columns),
+      m_choices(new QStringListModel(this))
+{}
+
+int ItemTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int ItemTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_columns.size();
+}
+
+QVariant ItemTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid()) return QVariant();
+    const ItemColumn &col = m_columns.at(index.column());
+    const QVariant value = m_rows.at(index.row()).value(index.column());
+
+    if (role == Qt::EditRole) return value;
+
+    switch (col.kind) {
+    case ItemColumn::Check:
+        if (role == Qt::CheckStateRole) return value.toBool() ? Qt::Checked : Qt::Unchecked;
+        return QVariant();
+    case ItemColumn::Lines:
+        if (role == Qt::DisplayRole) return value.toStringList().join(" · ");
+        if (role == Qt::ToolTipRole) return value.toStringList().join("\n");
+        return QVariant();
+    case ItemColumn::Image:
+        // Just the file name in the cell; the whole path is a hover away.
+        if (role == Qt::DisplayRole) return QFileInfo(value.toString()).fileName();
+        if (role == Qt::ToolTipRole) return value.toString();
+        if (role == Qt::DecorationRole) return thumbnail(index, value.toString());
+        return QVariant();
+    case ItemColumn::SharedChoice:
+        if (role == Qt::DisplayRole) return choiceName(value.toInt());
+        return QVariant();
+    case ItemColumn::Text:
+    case ItemColumn::RowChoice:
+        if (role == Qt::DisplayRole || role == Qt::ToolTipRole) return value.toString();
+        return QVariant();
+    }
+    return QVariant();
+}
+
+// A little preview next to the file name, decoded off the GUI thread (or
+// straight from the thumbnail cache); the cell repaints when it's ready.
+QVariant ItemTableModel::thumbnail(const QModelIndex &index, const QString &image) const
+{
+    if (image.isEmpty()) return QVariant();
+    ImageLoader *loader = ImageLoader::instance();
+    const QString path = loader->resolve(image);
+    const QPixmap pixmap = loader->cached(path, THUMBNAIL_SIZE);
+    if (!pixmap.isNull()) return pixmap;
+
+    auto self = const_cast<ItemTableModel*>(this);
+    const QPersistentModelIndex cell(index);
+    loader->load(path, THUMBNAIL_SIZE, self, [self, cell](const QPixmap &loaded) {
+        if (!loaded.isNull() && cell.isValid()) emit self->dataChanged(cell, cell, {Qt::DecorationRole});
+    });
+    return QVariant();
+}
+
+bool ItemTableModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!index.isValid()) return false;
+    const ItemColumn &col = m_columns.at(index.column());
+    QVariant stored = value;
+    if (col.kind == ItemColumn::Check) {
+        if (role != Qt::CheckStateRole) return false;
+        stored = value.toInt() == Qt::Checked;
+    } else if (role != Qt::EditRole) {
+        return false;
+    }
+
+    QVariant &cell = m_rows[index.row()][index.column()];
+    if (cell == stored) return false;
+    if (col.kind == ItemColumn::SharedChoice) unindexChoice(index);
+    cell = stored;
+    if (col.kind == ItemColumn::SharedChoice) indexChoice(index);
+    emit dataChanged(index, index, {role, Qt::DisplayRole});
+    return true;
+}
+
+Qt::ItemFlags ItemTableModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid()) return Qt::NoItemFlags;
+    const Qt::ItemFlags base = Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+    if (m_columns.at(index.column()).kind == ItemColumn::Check) return base | Qt::ItemIsUserCheckable;
+    return base | Qt::ItemIsEditable;
+}
+
+QVariant ItemTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole) return QVariant();
+    if (orientation == Qt::Vertical) return section + 1;
+    return m_columns.value(section).title;
+}
+
+bool ItemTableModel::removeRows(int row, int count, const QModelIndex &parent)
+{
+    if (parent.isValid() || count <= 0 || row < 0 || row + count > m_rows.size()) return false;
+    beginRemoveRows(QModelIndex(), row, row + count - 1);
+    m_rows.remove(row, count);
+    endRemoveRows();
+    return true;
+}
+
+int ItemTableModel::imageColumn() const
+{
+    for (int i = 0; i < m_columns.size(); ++i) {
+        if (m_columns[i].kind == ItemColumn::Image) return i;
+    }
+    return -1;
+}
+
+void ItemTableModel::setRows(const QList<QVariantList> &rows)
+{
+    beginResetModel();
+    m_rows = rows;
+    for (QVariantList &row : m_rows) row.resize(m_columns.size());
+    endResetModel();
+    indexChoices();
+}
+
+void ItemTableModel::appendRow(const QVariantList &values)
+{
+    beginInsertRows(QModelIndex(), m_rows.size(), m_rows.size());
+    m_rows.append(values);
+    QVariantList &row = m_rows.last();
+    row.resize(m_columns.size());
+    for (int c = 0; c < m_columns.size(); ++c) {
+        // No pick yet means the first choice, like a fresh dropdown.
+        if (m_columns[c].kind == ItemColumn::SharedChoice && !row[c].isValid()) row[c] = choiceIdAt(0);
+    }
+    endInsertRows();
+    for (int c = 0; c < m_columns.size(); ++c) {
+        if (m_columns[c].kind == ItemColumn::SharedChoice) indexChoice(index(m_rows.size() - 1, c));
+    }
+}
+
+QStringList ItemTableModel::choices() const
+{
+    return m_choices->stringList();
+}
+
+void ItemTableModel::setChoices(const QStringList &choices)
+{
+    m_choices->setStringList(choices);
+    m_choiceIds.clear();
+    for (int i = 0; i < choices.size(); ++i) m_choiceIds.append(m_nextChoiceId++);
+    indexChoices();
+    // Every id changed, so every choice cell did too.
+    for (int c = 0; c < m_columns.size(); ++c) {
+        if (m_columns[c].kind == ItemColumn::SharedChoice && !m_rows.isEmpty())
+            emit dataChanged(index(0, c), index(m_rows.size() - 1, c), {Qt::DisplayRole});
+    }
+}
+
+void ItemTableModel::appendChoice(const QString &text)
+{
+    const int position = m_choices->rowCount();
+    m_choices->insertRows(position, 1);
+    m_choices->setData(m_choices->index(position), text);
+    m_choiceIds.append(m_nextChoiceId++);
+}
+
+void ItemTableModel::renameChoice(int position, const QString &text)
+{
+    const QModelIndex entry = m_choices->index(position);
+    if (!entry.isValid() || entry.data().toString() == text) return;
+    m_choices->setData(entry, text);
+
+    // Open dropdowns follow the string model; the cells showing it need a repaint.
+    for (const QPersistentModelIndex &cell : m_cellsByChoice.value(m_choiceIds[position])) {
+        if (cell.isValid()) emit dataChanged(cell, cell, {Qt::DisplayRole});
+    }
+}
+
+void ItemTableModel::removeChoice(int position)
+{
+    if (position < 0 || position >= m_choiceIds.size()) return;
+    const int id = m_choiceIds.takeAt(position);
+    m_choices->removeRows(position, 1);
+
+    const QList<QPersistentModelIndex> affected = m_cellsByChoice.take(id);
+    const int fallback = choiceIdAt(0);
+    for (const QPersistentModelIndex &cell : affected) {
+        if (!cell.isValid()) continue;
+        m_rows[cell.row()][cell.column()] = fallback;
+        indexChoice(cell);
+        emit dataChanged(cell, cell, {Qt::EditRole, Qt::DisplayRole});
+    }
+}
+
+QString ItemTableModel::choiceName(int id) const
+{
+    const int position = choicePosition(id);
+    return position < 0 ? QString() : m_choices->index(position).data().toString();
+}
+
+QStringList ItemTableModel::choicesFor(const QModelIndex &index) const
+{
+    const ItemColumn &col = m_columns.at(index.column());
+    if (col.kind == ItemColumn::SharedChoice) return choices();
+    if (col.kind == ItemColumn::RowChoice && col.choicesFrom >= 0)
+        return m_rows.at(index.row()).value(col.choicesFrom).toStringList();
+    return QStringList();
+}
+
+void ItemTableModel::indexChoices()
+{
+    m_cellsByChoice.clear();
+    for (int c = 0; c < m_columns.size(); ++c) {
+        if (m_columns[c].kind != ItemColumn::SharedChoice) continue;
+        for (int r = 0; r < m_rows.size(); ++r) indexChoice(index(r, c));
+    }
+}
+
+void ItemTableModel::indexChoice(const QModelIndex &cell)
+{
+    const int id = m_rows[cell.row()][cell.column()].toInt();
+    if (choicePosition(id) >= 0) m_cellsByChoice[id].append(QPersistentModelIndex(cell));
+}
+
+void ItemTableModel::unindexChoice(const QModelIndex &cell)
+{
+    const auto it = m_cellsByChoice.find(m_rows[cell.row()][cell.column()].toInt());
+    if (it == m_cellsByChoice.end()) return;
+    // Removed rows leave invalid entries behind; tidy those up on the way.
+    it->removeIf([&cell](const QPersistentModelIndex &entry) { return !entry.isValid() || entry == cell; });
+}
+
+QWidget *ItemDelegate::createEditor(QWidget *parent, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    auto model = qobject_cast<const ItemTableModel*>(index.model());
+    if (!model) return QStyledItemDelegate::createEditor(parent, option, index);
+    const ItemColumn &col = model->column(index.column());
+
+    switch (col.kind) {
+    case ItemColumn::Check:
+        return nullptr;
+    case ItemColumn::Lines: {
+        auto edit = new QPlainTextEdit(parent);
+        edit->setPlaceholderText(col.placeholder);
+        return edit;
+    }
+    case ItemColumn::SharedChoice:
+    case ItemColumn::RowChoice: {
+        auto combo = new QComboBox(parent);
+        combo->setEditable(col.kind == ItemColumn::RowChoice);
+        if (col.kind == ItemColumn::SharedChoice) combo->setModel(model->choiceModel());
+        else combo->addItems(model->choicesFor(index));
+        // Picking from the list is the whole edit, no need to click away first.
+        connect(combo, &QComboBox::activated, this, [this, combo]() {
+            emit const_cast<ItemDelegate*>(this)->commitData(combo);
+        });
+        return combo;
+    }
+    case ItemColumn::Text:
+    case ItemColumn::Image: {
+        auto edit = new QLineEdit(parent);
+        edit->setPlaceholderText(col.placeholder);
+        edit->setFrame(false);
+        return edit;
+    }
+    }
+    return nullptr;
+}
+
+void ItemDelegate::setEditorData(QWidget *editor, const QModelIndex &index) const
+{
+    const QVariant value = index.data(Qt::EditRole);
+    if (auto edit = qobject_cast<QPlainTextEdit*>(editor)) {
+        edit->setPlainText(value.toStringList().join("\n"));
+    } else if (auto combo = qobject_cast<QComboBox*>(editor)) {
+        auto model = qobject_cast<const ItemTableModel*>(index.model());
+        if (combo->isEditable()) combo->setCurrentText(value.toString());
+        else if (model) combo->setCurrentIndex(model->choicePosition(value.toInt()));
+    } else if (auto edit = qobject_cast<QLineEdit*>(editor)) {
+        edit->setText(value.toString());
+    } else {
+        QStyledItemDelegate::setEditorData(editor, index);
+    }
+}
+
+void ItemDelegate::setModelData(QWidget *editor, QAbstractItemModel *model, const QModelIndex &index) const
+{
+    if (auto edit = qobject_cast<QPlainTextEdit*>(editor)) {
+        QStringList lines;
+        for (const QString &line : edit->toPlainText().split("\n", Qt::SkipEmptyParts))
+            lines.append(line.trimmed());
+        model->setData(index, lines);
+    } else if (auto combo = qobject_cast<QComboBox*>(editor)) {
+        auto items = qobject_cast<ItemTableModel*>(model);
+        if (combo->isEditable()) model->setData(index, combo->currentText());
+        else if (items) model->setData(index, items->choiceIdAt(combo->currentIndex()));
+    } else if (auto edit = qobject_cast<QLineEdit*>(editor)) {
+        model->setData(index, edit->text());
+    } else {
+        QStyledItemDelegate::setModelData(editor, model, index);
+    }
+}
+
+void ItemDelegate::updateEditorGeometry(QWidget *editor, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    // Multi-line cells get room to breathe; it floats over the rows below.
+    QRect rect = option.rect;
+    if (qobject_cast<QPlainTextEdit*>(editor)) rect.setHeight(qMax(rect.height(), 110));
+    editor->setGeometry(rect);
+    Q_UNUSED(index);
+}
+
+ItemTable::ItemTable(const QList<ItemColumn> &columns, QWidget *parent)
+    : QWidget(parent),
+      m_model(new ItemTableModel(columns, this)),
+      m_view(new QTableView())
+{
+    auto layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+
+    m_view->setModel(m_model);
+    m_view->setItemDelegate(new ItemDelegate(m_view));
+    m_view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_view->setEditTriggers(QAbstractItemView::DoubleClicked | QAbstractItemView::SelectedClicked
+                            | QAbstractItemView::EditKeyPressed | QAbstractItemView::AnyKeyPressed);
+    m_view->setWordWrap(false);
+    m_view->setIconSize(QSize(ItemTableModel::THUMBNAIL_SIZE, ItemTableModel::THUMBNAIL_SIZE));
+    m_view->setAlternatingRowColors(true);
+    // Fixed row heights, so the view never measures rows it isn't showing.
+    m_view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    m_view->horizontalHeader()->setStretchLastSection(false);
+    for (int c = 0; c < columns.size(); ++c) {
+        const bool narrow = columns[c].kind == ItemColumn::Check;
+        m_view->horizontalHeader()->setSectionResizeMode(c, narrow ? QHeaderView::ResizeToContents : QHeaderView::Stretch);
+    }
+    layout->addWidget(m_view, 1);
+
+    auto buttons = new QHBoxLayout();
+    m_addButton = new QPushButton("Add 💖");
+    connect(m_addButton, &QPushButton::clicked, this, &ItemTable::addRow);
+    auto removeButton = new QPushButton("Remove Selected 🗑️");
+    connect(removeButton, &QPushButton::clicked, this, &ItemTable::removeSelectedRows);
+    buttons->addWidget(m_addButton);
+    buttons->addWidget(removeButton);
+    if (m_model->imageColumn() >= 0) {
+        auto browseButton = new QPushButton("Browse Image 🖼️");
+        connect(browseButton, &QPushButton::clicked, this, &ItemTable::browseImage);
+        buttons->addWidget(browseButton);
+    }
+    buttons->addStretch();
+    layout->addLayout(buttons);
+
+    // A thumbnail finishing isn't an edit.
+    connect(m_model, &QAbstractItemModel::dataChanged, this, [this](const QModelIndex &, const QModelIndex &, const QList<int> &roles) {
+        if (roles != QList<int>{Qt::DecorationRole}) emit changed();
+    });
+    connect(m_model, &QAbstractItemModel::rowsInserted, this, &ItemTable::changed);
+    connect(m_model, &QAbstractItemModel::rowsRemoved, this, &ItemTable::changed);
+}
+
+void ItemTable::setAddText(const QString &text)
+{
+    m_addButton->setText(text);
+}
+
+void ItemTable::addRow()
+{
+    m_model->appendRow(m_newRow);
+    const QModelIndex added = m_model->index(m_model->rowCount() - 1, 0);
+    m_view->scrollTo(added);
+    m_view->setCurrentIndex(added);
+}
+
+void ItemTable::removeSelectedRows()
+{
+    QList<int> rows;
+    for (const QModelIndex &index : m_view->selectionModel()->selectedRows()) rows.append(index.row());
+    if (rows.isEmpty() && m_view->currentIndex().isValid()) rows.append(m_view->currentIndex().row());
+    std::sort(rows.begin(), rows.end(), std::greater<int>());
+
+    // Bottom-up, so the rows still to go keep their numbers.
+    for (int row : std::as_const(rows)) {
+        if (m_model->rowCount() <= m_minimumRows) break;
+        m_model->removeRow(row);
+    }
+}
+
+void ItemTable::browseImage()
+{
+    const int column = m_model->imageColumn();
+    const QModelIndex current = m_view->currentIndex();
+    if (column < 0 || !current.isValid()) return;
+
+    QString fileName = QFileDialog::getOpenFileName(this,
+        "💖 Select Adorable Image File 💖", "",
+        "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)");
+    if (!fileName.isEmpty()) m_model->setData(m_model->index(current.row(), column), fileName);
+}
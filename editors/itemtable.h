@@ -0,0 +1,142 @@
+#ifndef ITEMTABLE_H
+#define ITEMTABLE_H
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QList>
+#include <QPersistentModelIndex>
+#include <QStringList>
+#include <QStyledItemDelegate>
+#include <QVariant>
+#include <QWidget>
+
+class QTableView;
+class QPushButton;
+class QStringListModel;
+
+// One column of an item table: what it holds and how a cell gets edited.
+struct ItemColumn
+{
+    enum Kind {
+        Text,         // One line of text
+        Lines,        // A QStringList, edited one entry per line
+        Check,        // A checkbox, painted by the view, no editor at all
+        Image,        // An image path (the table's browse button fills it in)
+        SharedChoice, // Id of one of the model's shared choices (categories...)
+        RowChoice     // Free text, suggested from this row's Lines column choicesFrom
+    };
+
+    QString title;
+    Kind kind = Text;
+    QString placeholder;
+    int choicesFrom = -1;
+};
+
+// The rows of an editor's item list (options, pairs, items...) as plain
+// values. Nothing in here is a widget, so a list of 800 items costs 800
+// small QVariantLists instead of 800 rows of line edits and buttons.
+class ItemTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    explicit ItemTableModel(const QList<ItemColumn> &columns, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    bool removeRows(int row, int count, const QModelIndex &parent = QModelIndex()) override;
+
+    static constexpr int THUMBNAIL_SIZE = 24;
+
+    const ItemColumn &column(int column) const { return m_columns.at(column); }
+    int imageColumn() const; // -1 without one
+
+    // Loading swaps everything in with one reset; that isn't an edit.
+    void setRows(const QList<QVariantList> &rows);
+    void appendRow(const QVariantList &values);
+    const QList<QVariantList> &rows() const { return m_rows; }
+
+    // Shared choices for SharedChoice columns, as one QStringListModel that
+    // every open dropdown shows. Cells hold a choice id that survives renames
+    // and the other choices moving, and each id knows which cells picked it,
+    // so renaming or deleting a choice only touches those cells.
+    QStringListModel *choiceModel() const { return m_choices; }
+    QStringList choices() const;
+    void setChoices(const QStringList &choices);
+    void appendChoice(const QString &text);
+    void renameChoice(int position, const QString &text);
+    void removeChoice(int position); // Cells that picked it fall back to the first choice
+    int choiceIdAt(int position) const { return m_choiceIds.value(position, -1); }
+    int choicePosition(int id) const { return m_choiceIds.indexOf(id); }
+    QString choiceName(int id) const;
+    QStringList choicesFor(const QModelIndex &index) const;
+
+private:
+    QVariant thumbnail(const QModelIndex &index, const QString &image) const;
+    void indexChoices();
+    void indexChoice(const QModelIndex &cell);
+    void unindexChoice(const QModelIndex &cell);
+
+    QList<ItemColumn> m_columns;
+    QList<QVariantList> m_rows;
+    QStringListModel *m_choices;
+    QList<int> m_choiceIds; // Parallel to m_choices' rows
+    int m_nextChoiceId = 0;
+    QHash<int, QList<QPersistentModelIndex>> m_cellsByChoice;
+};
+
+// Hands out an editor for the one cell being edited and takes it back after.
+class ItemDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    using QStyledItemDelegate::QStyledItemDelegate;
+
+    QWidget *createEditor(QWidget *parent, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    void setEditorData(QWidget *editor, const QModelIndex &index) const override;
+    void setModelData(QWidget *editor, QAbstractItemModel *model, const QModelIndex &index) const override;
+    void updateEditorGeometry(QWidget *editor, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+};
+
+// 💖 An item list for the editors: a table over an ItemTableModel with
+// add / remove (and browse, when there's an image column) buttons under it.
+// Only the visible rows get painted and only the edited cell has a widget,
+// so opening a question with hundreds of items is instant.
+class ItemTable : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit ItemTable(const QList<ItemColumn> &columns, QWidget *parent = nullptr);
+
+    ItemTableModel *model() const { return m_model; }
+    QTableView *view() const { return m_view; }
+
+    // What "Add" appends, and how many rows "Remove" always leaves behind.
+    void setNewRow(const QVariantList &values) { m_newRow = values; }
+    void setMinimumRows(int rows) { m_minimumRows = rows; }
+    void setAddText(const QString &text);
+
+public slots:
+    void addRow();
+    void removeSelectedRows();
+    void browseImage();
+
+signals:
+    // Anything that edits the rows. Loading with setRows() doesn't count.
+    void changed();
+
+private:
+    ItemTableModel *m_model;
+    QTableView *m_view;
+    QPushButton *m_addButton;
+    QVariantList m_newRow;
+    int m_minimumRows = 1;
+};
+
+#endif // ITEMTABLE_H
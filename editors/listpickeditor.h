@@ -11,6 +11,7 @@
 #define LISTPICKEDITOR_H
 
 #include "../basequestioneditor.h"
+#include "itemtable.h"
 #include <QtWidgets>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -26,28 +27,17 @@ public:
 
 private slots:
     void addOption();
-    // 💖 Our new slot to browse for media! So cute! 💖
-    void browseMedia();
 
 private:
     void refreshOptionsUI();
-    void clearOptions();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
-    QVBoxLayout* m_optionsLayout;
+    ItemTable* m_optionsTable;
     
-    // 💖 Our new UI elements for optional media! 💖
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
 
     // Data storage
     QJsonObject m_currentQuestion;
-    QList<QWidget*> m_optionWidgets;
 };
 
 #endif // LISTPICKEDITOR_H
@@ -11,6 +11,7 @@
 #define MATCHPHRASESEDITOR_H
 
 #include "../basequestioneditor.h"
+#include "itemtable.h"
 #include <QtWidgets>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -26,25 +27,16 @@ public:
 
 private slots:
     void addPair();
-    void browseMedia();
 
 private:
     void refreshPairsUI();
-    void clearPairs();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
-    QVBoxLayout* m_pairsLayout;
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
+    ItemTable* m_pairsTable;
 
     // Data storage
     QJsonObject m_currentQuestion;
-    QList<QWidget*> m_pairWidgets;
 };
 
 #endif // MATCHPHRASESEDITOR_H
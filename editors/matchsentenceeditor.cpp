@@ -14,6 +14,8 @@
 
 #include "matchsentenceeditor.h"
 #include "../helpers.h"
+#include "../theme.h"
+#include "questionheader.h"
 #include <QFileDialog>
 #include <QMessageBox>
 
@@ -22,32 +24,6 @@ MatchSentenceEditor::MatchSentenceEditor(QWidget *parent) : BaseQuestionEditor(p
     auto mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(15);
 
-        // ... (rest of the constructor UI setup is the same) ...
-    
-    // 💖 ADD THIS SNIPPET FOR THE LESSON PDF SECTION 💖
-    auto lessonGroup = new QGroupBox("📚 Lesson PDF (Optional) 📚");
-    auto lessonLayout = new QVBoxLayout(lessonGroup);
-    auto lessonRowLayout = new QHBoxLayout();
-    
-    m_lessonPdfEdit = new QLineEdit();
-    m_lessonPdfEdit->setPlaceholderText("Select the PDF file for this lesson...");
-    
-    m_lessonPdfButton = new QPushButton("Browse 📁");
-    connect(m_lessonPdfButton, &QPushButton::clicked, this, [this]() {
-        QString filePath = QFileDialog::getOpenFileName(this, "💖 Select Lesson PDF File 💖", "", "PDF Files (*.pdf);;All Files (*)");
-        if (!filePath.isEmpty()) {
-            m_lessonPdfEdit->setText(filePath);
-        }
-    });
-
-    lessonRowLayout->addWidget(new QLabel("File:"));
-    lessonRowLayout->addWidget(m_lessonPdfEdit, 1);
-    lessonRowLayout->addWidget(m_lessonPdfButton);
-
-    lessonLayout->addLayout(lessonRowLayout);
-    mainLayout->addWidget(lessonGroup);
-    // 💖 END SNIPPET 💖
-
     // Question text section
     auto questionGroup = new QGroupBox("❓ Question Prompt ❓");
     auto questionLayout = new QVBoxLayout(questionGroup);
@@ -56,41 +32,9 @@ MatchSentenceEditor::MatchSentenceEditor(QWidget *parent) : BaseQuestionEditor(p
     m_questionTextEdit->setPlaceholderText("Match the adorable sentences with images! 💖");
     questionLayout->addWidget(m_questionTextEdit);
 
-    mainLayout->addWidget(questionGroup);
-
-        // ✨ Our new hint section! So cute! ✨
-    auto hintGroup = new QGroupBox("💡 Hint (Optional) 💡");
-    auto hintLayout = new QVBoxLayout(hintGroup);
-    m_hintTextEdit = new QTextEdit();
-    m_hintTextEdit->setPlaceholderText("A little hint for your love... 💕");
-    m_hintTextEdit->setMaximumHeight(80); // Keep it smol
-    hintLayout->addWidget(m_hintTextEdit);
-    mainLayout->addWidget(hintGroup);
-
-
-    // Media section  
-    auto mediaGroup = new QGroupBox("🎬 Media (Optional) 🎬");
-    auto mediaLayout = new QVBoxLayout(mediaGroup);
-
-    auto mediaRowLayout = new QHBoxLayout();
-    m_mediaTypeCombo = new QComboBox();
-    // 💖 I've added 'Image' here so you can select it from the dropdown! 💖
-    m_mediaTypeCombo->addItems({"None", "Video", "Audio", "Image"});
-
-    m_mediaEdit = new QLineEdit();
-    m_mediaEdit->setPlaceholderText("Select media file path...");
-
-    auto browseMediaBtn = new QPushButton("Browse 📁");
-    connect(browseMediaBtn, &QPushButton::clicked, this, &MatchSentenceEditor::browseMedia);
-
-    mediaRowLayout->addWidget(new QLabel("Type:"));
-    mediaRowLayout->addWidget(m_mediaTypeCombo);
-    mediaRowLayout->addWidget(new QLabel("File:"));
-    mediaRowLayout->addWidget(m_mediaEdit, 1);
-    mediaRowLayout->addWidget(browseMediaBtn);
-
-    mediaLayout->addLayout(mediaRowLayout);
-    mainLayout->addWidget(mediaGroup);
+    // 💖 Lesson PDF, hint and media come with the shared header 💖
+    m_header = new QuestionHeader(questionGroup);
+    mainLayout->addWidget(m_header);
 
     // Sentence-image pairs section
     auto pairsGroup = new QGroupBox("🖼️ Sentence-Image Pairs 🖼️");
@@ -98,7 +42,7 @@ MatchSentenceEditor::MatchSentenceEditor(QWidget *parent) : BaseQuestionEditor(p
 
     auto pairsLabel = new QLabel("💡 Create pairs of sentences and their matching images!");
     pairsLabel->setWordWrap(true);
-    pairsLabel->setStyleSheet("font-style: italic; color: #8B008B;");
+    Theme::setRole(pairsLabel, "tip");
     pairsGroupLayout->addWidget(pairsLabel);
 
     QScrollArea *pairsScrollArea = new QScrollArea();
@@ -130,44 +74,17 @@ MatchSentenceEditor::MatchSentenceEditor(QWidget *parent) : BaseQuestionEditor(p
     m_currentQuestion["media"] = QJsonValue::Null;
 
     refreshPairsUI();
+
+    trackEdits(this);
 }
 
 void MatchSentenceEditor::loadJson(const QJsonObject& question) 
 {
     m_currentQuestion = question;
+    m_header->loadJson(question);
 
     m_questionTextEdit->setText(question["question"].toString());
 
-        // ✨ Load the hint text! ✨
-    m_hintTextEdit->setText(question["hint"].toString());
-
-    // Load media
-    QJsonValue mediaValue = question["media"];
-    if (mediaValue.isNull()) {
-        m_mediaTypeCombo->setCurrentText("None");
-        m_mediaEdit->clear();
-    } else {
-        QJsonObject media = mediaValue.toObject();
-        if (media.contains("video")) {
-            m_mediaTypeCombo->setCurrentText("Video");
-            m_mediaEdit->setText(media["video"].toString());
-        } else if (media.contains("audio")) {
-            m_mediaTypeCombo->setCurrentText("Audio");  
-            m_mediaEdit->setText(media["audio"].toString());
-        // 💖 And our new 'image' type! So cute! 💖
-        } else if (media.contains("image")) {
-            m_mediaTypeCombo->setCurrentText("Image");
-            m_mediaEdit->setText(media["image"].toString());
-        }
-    }
-
-    // 💖 ADDED: Load the PDF path! 💖
-    QJsonObject lessonObj = question["lesson"].toObject();
-    if (m_lessonPdfEdit) {
-        m_lessonPdfEdit->setText(lessonObj["pdf"].toString());
-    }
-
-
     refreshPairsUI();
 }
 
@@ -176,25 +93,7 @@ QJsonObject MatchSentenceEditor::getJson()
     m_currentQuestion["question"] = m_questionTextEdit->toPlainText();
     m_currentQuestion["type"] = "match_sentence";
 
-        // ✨ Save the hint text! ✨
-    QString hintText = m_hintTextEdit->toPlainText().trimmed();
-    if (!hintText.isEmpty()) {
-        m_currentQuestion["hint"] = hintText;
-    } else {
-        m_currentQuestion.remove("hint");
-    }
-
-    // Handle media
-    QString mediaType = m_mediaTypeCombo->currentText();
-    QString mediaPath = m_mediaEdit->text().trimmed();
-
-    if (mediaType == "None" || mediaPath.isEmpty()) {
-        m_currentQuestion["media"] = QJsonValue::Null;
-    } else {
-        QJsonObject media;
-        media[mediaType.toLower()] = mediaPath;
-        m_currentQuestion["media"] = media;
-    }
+    m_header->saveJson(m_currentQuestion);
 
     // Save pairs and generate answer mapping
     QJsonArray pairsArray;
@@ -223,21 +122,6 @@ QJsonObject MatchSentenceEditor::getJson()
     m_currentQuestion["pairs"] = pairsArray;
     m_currentQuestion["answer"] = answerObject;
 
-        // 💖 ADD THIS SNIPPET TO SAVE THE LESSON PDF 💖
-    // Handle lesson PDF
-    if (m_lessonPdfEdit) {
-        QString pdfPath = m_lessonPdfEdit->text().trimmed();
-        if (!pdfPath.isEmpty()) {
-            QJsonObject lessonObj;
-            lessonObj["pdf"] = pdfPath;
-            m_currentQuestion["lesson"] = lessonObj;
-        } else {
-            m_currentQuestion.remove("lesson");
-        }
-    }
-    // 💖 END SNIPPET 💖
-
-
     return m_currentQuestion;
 }
 
@@ -246,75 +130,69 @@ void MatchSentenceEditor::refreshPairsUI()
     clearPairs();
 
     QJsonArray pairs = m_currentQuestion["pairs"].toArray();
-
-    for (int i = 0; i < pairs.size(); ++i) {
-        QJsonObject pair = pairs[i].toObject();
-        QString sentence = pair["sentence"].toString();
-        QString imagePath = pair["image_path"].toString();
-
-        QWidget* row = new QWidget();
-        row->setStyleSheet("QWidget { border: 2px solid #FF69B4; border-radius: 10px; margin: 5px; padding: 10px; }");
-        auto layout = new QVBoxLayout(row);
-
-        // Header
-        auto headerLayout = new QHBoxLayout();
-        auto pairLabel = new QLabel(QString("🖼️ Pair %1 🖼️").arg(i + 1));
-        pairLabel->setStyleSheet("font-weight: bold; font-size: 14px; color: #8B008B;");
-
-        QPushButton* deleteButton = new QPushButton("Delete Pair 🗑️");
-        connect(deleteButton, &QPushButton::clicked, [this, i](){
-            QJsonArray current = m_currentQuestion["pairs"].toArray();
-            if (current.size() > 1) {
-                current.removeAt(i);
-                m_currentQuestion["pairs"] = current;
-                refreshPairsUI();
-            }
-        });
-
-        headerLayout->addWidget(pairLabel);
-        headerLayout->addStretch();
-        headerLayout->addWidget(deleteButton);
-        layout->addLayout(headerLayout);
-
-        // Sentence input
-        auto sentenceLayout = new QHBoxLayout();
-        sentenceLayout->addWidget(new QLabel("📝 Sentence:"));
-        QLineEdit* sentenceEdit = new QLineEdit(sentence);
-        sentenceEdit->setPlaceholderText("Sentence text...");
-        sentenceLayout->addWidget(sentenceEdit, 1);
-        layout->addLayout(sentenceLayout);
-
-        // Image input
-        auto imageLayout = new QHBoxLayout();
-        imageLayout->addWidget(new QLabel("🖼️ Image:"));
-        QLineEdit* imageEdit = new QLineEdit(imagePath);
-        imageEdit->setPlaceholderText("Image path...");
-
-        QPushButton* browseButton = new QPushButton("Browse 📁");
-        connect(browseButton, &QPushButton::clicked, [this, imageEdit](){
-            browseImage(imageEdit);
-        });
-
-        imageLayout->addWidget(imageEdit, 1);
-        imageLayout->addWidget(browseButton);
-        layout->addLayout(imageLayout);
-
-        m_pairsLayout->addWidget(row);
-        m_pairWidgets.append(row);
+    for (const QJsonValue &value : pairs) {
+        QJsonObject pair = value.toObject();
+        appendPairRow(pair["sentence"].toString(), pair["image_path"].toString());
     }
 }
 
-void MatchSentenceEditor::addPair() 
+void MatchSentenceEditor::appendPairRow(const QString &sentence, const QString &imagePath)
 {
-    QJsonArray pairs = m_currentQuestion["pairs"].toArray();
+    QWidget* row = new QWidget();
+    Theme::setRole(row, "card");
+    auto layout = new QVBoxLayout(row);
+
+    // Header
+    auto headerLayout = new QHBoxLayout();
+    auto pairLabel = new QLabel(QString("🖼️ Pair %1 🖼️").arg(m_pairWidgets.size() + 1));
+    pairLabel->setObjectName("rowNumber");
+    Theme::setRole(pairLabel, "cardTitle");
+
+    QPushButton* deleteButton = new QPushButton("Delete Pair 🗑️");
+    connect(deleteButton, &QPushButton::clicked, this, [this, row](){
+        if (m_pairWidgets.size() <= 1) return;
+        const int index = removeRow(m_pairWidgets, m_pairsLayout, row);
+        for (int i = qMax(index, 0); i < m_pairWidgets.size(); ++i) {
+            if (QLabel *label = rowNumberLabel(m_pairWidgets[i])) label->setText(QString("🖼️ Pair %1 🖼️").arg(i + 1));
+        }
+    });
 
-    QJsonObject newPair;
-    newPair["sentence"] = "New cute sentence";
-    newPair["image_path"] = "new_image.jpg";
-    pairs.append(newPair);
+    headerLayout->addWidget(pairLabel);
+    headerLayout->addStretch();
+    headerLayout->addWidget(deleteButton);
+    layout->addLayout(headerLayout);
+
+    // Sentence input
+    auto sentenceLayout = new QHBoxLayout();
+    sentenceLayout->addWidget(new QLabel("📝 Sentence:"));
+    QLineEdit* sentenceEdit = new QLineEdit(sentence);
+    sentenceEdit->setPlaceholderText("Sentence text...");
+    sentenceLayout->addWidget(sentenceEdit, 1);
+    layout->addLayout(sentenceLayout);
+
+    // Image input
+    auto imageLayout = new QHBoxLayout();
+    imageLayout->addWidget(new QLabel("🖼️ Image:"));
+    QLineEdit* imageEdit = new QLineEdit(imagePath);
+    imageEdit->setPlaceholderText("Image path...");
+
+    QPushButton* browseButton = new QPushButton("Browse 📁");
+    connect(browseButton, &QPushButton::clicked, [this, imageEdit](){
+        browseImage(imageEdit);
+    });
 
-    m_currentQuestion["pairs"] = pairs;
-    refreshPairsUI();
+    imageLayout->addWidget(imageEdit, 1);
+    imageLayout->addWidget(browseButton);
+    layout->addLayout(imageLayout);
+
+    m_pairsLayout->addWidget(row);
+    trackEdits(row);
+    m_pairWidgets.append(row);
+}
+
+void MatchSentenceEditor::addPair() 
+{
+    appendPairRow("New cute sentence", "new_image.jpg");
 }
 
 void MatchSentenceEditor::clearPairs()
@@ -337,26 +215,3 @@ void MatchSentenceEditor::browseImage(QLineEdit* imageEdit)
     }
 }
 
-void MatchSentenceEditor::browseMedia()
-{
-    QString filter;
-    QString mediaType = m_mediaTypeCombo->currentText().toLower();
-
-    if (mediaType == "video") {
-        filter = "Video Files (*.mp4 *.avi *.mov *.mkv);;All Files (*)";
-    } else if (mediaType == "audio") {
-        filter = "Audio Files (*.mp3 *.wav *.ogg *.m4a);;All Files (*)";
-    // 💖 I've added our new image filter! 💖
-    } else if (mediaType == "image") {
-        filter = "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)";
-    } else {
-        return;
-    }
-
-    QString fileName = QFileDialog::getOpenFileName(this,
-        "💖 Select Cute Media File 💖", "", filter);
-
-    if (!fileName.isEmpty()) {
-        m_mediaEdit->setText(fileName);
-    }
-}
\ No newline at end of file
@@ -26,22 +26,16 @@ public:
 
 private slots:
     void addPair();
-    void browseMedia();
     void browseImage(QLineEdit* imageEdit);
 
 private:
     void refreshPairsUI();
+    void appendPairRow(const QString &sentence, const QString &imagePath);
     void clearPairs();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
     QVBoxLayout* m_pairsLayout;
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
 
     // Data storage
     QJsonObject m_currentQuestion;
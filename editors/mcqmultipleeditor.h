@@ -11,6 +11,7 @@
 #define MCQMULTIPLEEDITOR_H
 
 #include "../basequestioneditor.h"
+#include "itemtable.h"
 #include <QtWidgets>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -26,26 +27,14 @@ public:
 
 private slots:
     void addOption();
-    void browseImage(QLineEdit* imageEdit);
-    void browseMedia();
 
 private:
-    void createOptionRow(bool correct = false, const QString &text = "", const QString &image = "");
-    void clearOptions();
-
     // UI Elements
     QTextEdit* m_questionTextEdit;
-    QVBoxLayout* m_optionsLayout;
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
+    ItemTable* m_optionsTable;
 
     // Data storage
     QJsonObject m_currentQuestion;
-    QList<QWidget*> m_optionWidgets;
 };
 
 #endif // MCQMULTIPLEEDITOR_H
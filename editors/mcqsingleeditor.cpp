@@ -15,6 +15,8 @@
 
 #include "mcqsingleeditor.h"
 #include "../helpers.h"
+#include "questionheader.h"
+#include "../imageloader.h"
 #include <QFileDialog>
 #include <QMessageBox>
 
@@ -23,32 +25,6 @@ MCQSingleEditor::MCQSingleEditor(QWidget *parent) : BaseQuestionEditor(parent)
     auto mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(15);
 
-        // ... (rest of the constructor UI setup is the same) ...
-    
-    // 💖 ADD THIS SNIPPET FOR THE LESSON PDF SECTION 💖
-    auto lessonGroup = new QGroupBox("📚 Lesson PDF (Optional) 📚");
-    auto lessonLayout = new QVBoxLayout(lessonGroup);
-    auto lessonRowLayout = new QHBoxLayout();
-    
-    m_lessonPdfEdit = new QLineEdit();
-    m_lessonPdfEdit->setPlaceholderText("Select the PDF file for this lesson...");
-    
-    m_lessonPdfButton = new QPushButton("Browse 📁");
-    connect(m_lessonPdfButton, &QPushButton::clicked, this, [this]() {
-        QString filePath = QFileDialog::getOpenFileName(this, "💖 Select Lesson PDF File 💖", "", "PDF Files (*.pdf);;All Files (*)");
-        if (!filePath.isEmpty()) {
-            m_lessonPdfEdit->setText(filePath);
-        }
-    });
-
-    lessonRowLayout->addWidget(new QLabel("File:"));
-    lessonRowLayout->addWidget(m_lessonPdfEdit, 1);
-    lessonRowLayout->addWidget(m_lessonPdfButton);
-
-    lessonLayout->addLayout(lessonRowLayout);
-    mainLayout->addWidget(lessonGroup);
-    // 💖 END SNIPPET 💖
-
     // Question prompt section - so cute! 💖
     auto questionGroup = new QGroupBox("❓ Question Prompt ❓");
     auto questionLayout = new QVBoxLayout(questionGroup);
@@ -57,41 +33,9 @@ MCQSingleEditor::MCQSingleEditor(QWidget *parent) : BaseQuestionEditor(parent)
     questionPromptEdit->setPlaceholderText("What does Sierra love most about Emily? 💕");
     questionLayout->addWidget(questionPromptEdit);
 
-    mainLayout->addWidget(questionGroup);
-
-        // ✨ Our new hint section! So cute! ✨
-    auto hintGroup = new QGroupBox("💡 Hint (Optional) 💡");
-    auto hintLayout = new QVBoxLayout(hintGroup);
-    m_hintTextEdit = new QTextEdit();
-    m_hintTextEdit->setPlaceholderText("A little hint for your love... 💕");
-    m_hintTextEdit->setMaximumHeight(80); // Keep it smol
-    hintLayout->addWidget(m_hintTextEdit);
-    mainLayout->addWidget(hintGroup);
-
-
-    // Media section - for videos and audio! 🎵
-    auto mediaGroup = new QGroupBox("🎬 Media (Optional) 🎬");
-    auto mediaLayout = new QVBoxLayout(mediaGroup);
-
-    auto mediaRowLayout = new QHBoxLayout();
-    mediaTypeCombo = new QComboBox();
-    // 💖 I've added 'Image' here so you can select it from the dropdown! 💖
-    mediaTypeCombo->addItems({"None", "Video", "Audio", "Image"});
-
-    mediaEdit = new QLineEdit();
-    mediaEdit->setPlaceholderText("Select media file path...");
-
-    auto browseMediaBtn = new QPushButton("Browse 📁");
-    connect(browseMediaBtn, &QPushButton::clicked, this, &MCQSingleEditor::browseMedia);
-
-    mediaRowLayout->addWidget(new QLabel("Type:"));
-    mediaRowLayout->addWidget(mediaTypeCombo);
-    mediaRowLayout->addWidget(new QLabel("File:"));
-    mediaRowLayout->addWidget(mediaEdit, 1);
-    mediaRowLayout->addWidget(browseMediaBtn);
-
-    mediaLayout->addLayout(mediaRowLayout);
-    mainLayout->addWidget(mediaGroup);
+    // 💖 Lesson PDF, hint and media come with the shared header 💖
+    m_header = new QuestionHeader(questionGroup);
+    mainLayout->addWidget(m_header);
 
     // Answer options section - the main event! ✨
     auto optionsGroup = new QGroupBox("💎 Answer Options (Pick one!) 💎");  
@@ -124,6 +68,8 @@ MCQSingleEditor::MCQSingleEditor(QWidget *parent) : BaseQuestionEditor(parent)
     // Add some default options to start
     addOption();
     addOption();
+
+    trackEdits(this);
 }
 
 void MCQSingleEditor::addOption()
@@ -164,6 +110,24 @@ void MCQSingleEditor::createOptionRow(bool correct, const QString &text, const Q
         browseImage(imageEdit);
     });
 
+    // A little preview, straight from the thumbnail cache when we've seen it before
+    QLabel *thumbnail = new QLabel();
+    thumbnail->setFixedSize(THUMBNAIL_SIZE, THUMBNAIL_SIZE);
+    thumbnail->setAlignment(Qt::AlignCenter);
+    auto showThumbnail = [thumbnail, imageEdit]() {
+        thumbnail->clear();
+        const QString path = ImageLoader::instance()->resolve(imageEdit->text().trimmed());
+        thumbnail->setProperty("imageRequest", path);
+        if (path.isEmpty()) return;
+        ImageLoader::instance()->load(path, THUMBNAIL_SIZE, thumbnail, [thumbnail, path](const QPixmap &pixmap) {
+            if (pixmap.isNull() || thumbnail->property("imageRequest").toString() != path) return;
+            thumbnail->setPixmap(pixmap.scaled(THUMBNAIL_SIZE, THUMBNAIL_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+        });
+    };
+    connect(imageEdit, &QLineEdit::textChanged, thumbnail, showThumbnail);
+    showThumbnail();
+
+    bottomRow->addWidget(thumbnail);
     bottomRow->addWidget(new QLabel("Image:"));
     bottomRow->addWidget(imageEdit, 1);
     bottomRow->addWidget(browseButton);
@@ -172,6 +136,7 @@ void MCQSingleEditor::createOptionRow(bool correct, const QString &text, const Q
     layout->addLayout(bottomRow);
 
     optionsLayout->addWidget(optionWidget);
+    trackEdits(optionWidget);
     optionWidgets.append(optionWidget);
 
     connect(removeButton, &QPushButton::clicked, [this, optionWidget]() {
@@ -186,40 +151,11 @@ void MCQSingleEditor::createOptionRow(bool correct, const QString &text, const Q
 void MCQSingleEditor::loadJson(const QJsonObject &question)
 {
     m_currentQuestion = question;
+    m_header->loadJson(question);
 
     // Load question text
     questionPromptEdit->setText(question["question"].toString());
 
-        // ✨ Load the hint text! ✨
-    m_hintTextEdit->setText(question["hint"].toString());
-
-    // Load media
-    QJsonValue mediaValue = question["media"];
-    if (mediaValue.isNull()) {
-        mediaTypeCombo->setCurrentText("None");
-        mediaEdit->clear();
-    } else {
-        QJsonObject media = mediaValue.toObject();
-        if (media.contains("video")) {
-            mediaTypeCombo->setCurrentText("Video");
-            mediaEdit->setText(media["video"].toString());
-        } else if (media.contains("audio")) {
-            mediaTypeCombo->setCurrentText("Audio");  
-            mediaEdit->setText(media["audio"].toString());
-        // 💖 And our new 'image' type! So cute! 💖
-        } else if (media.contains("image")) {
-            mediaTypeCombo->setCurrentText("Image");
-            mediaEdit->setText(media["image"].toString());
-        }
-    }
-
-        // 💖 ADDED: Load the PDF path! 💖
-    QJsonObject lessonObj = question["lesson"].toObject();
-    if (m_lessonPdfEdit) {
-        m_lessonPdfEdit->setText(lessonObj["pdf"].toString());
-    }
-
-
     clearOptions();
 
     QJsonArray options = question["options"].toArray();
@@ -259,25 +195,7 @@ QJsonObject MCQSingleEditor::getJson()
     m_currentQuestion["question"] = questionPromptEdit->toPlainText();
     m_currentQuestion["type"] = "mcq_single";
 
-        // ✨ Save the hint text! ✨
-    QString hintText = m_hintTextEdit->toPlainText().trimmed();
-    if (!hintText.isEmpty()) {
-        m_currentQuestion["hint"] = hintText;
-    } else {
-        m_currentQuestion.remove("hint");
-    }
-
-    // Handle media
-    QString mediaType = mediaTypeCombo->currentText();
-    QString mediaPath = mediaEdit->text().trimmed();
-
-    if (mediaType == "None" || mediaPath.isEmpty()) {
-        m_currentQuestion["media"] = QJsonValue::Null;
-    } else {
-        QJsonObject media;
-        media[mediaType.toLower()] = mediaPath;
-        m_currentQuestion["media"] = media;
-    }
+    m_header->saveJson(m_currentQuestion);
 
     QJsonArray optionsArray;
     int correctAnswerIndex = -1;
@@ -313,21 +231,6 @@ QJsonObject MCQSingleEditor::getJson()
     m_currentQuestion["options"] = optionsArray;
     m_currentQuestion["answer"] = QJsonArray{correctAnswerIndex >= 0 ? correctAnswerIndex : 0};
 
-        // 💖 ADD THIS SNIPPET TO SAVE THE LESSON PDF 💖
-    // Handle lesson PDF
-    if (m_lessonPdfEdit) {
-        QString pdfPath = m_lessonPdfEdit->text().trimmed();
-        if (!pdfPath.isEmpty()) {
-            QJsonObject lessonObj;
-            lessonObj["pdf"] = pdfPath;
-            m_currentQuestion["lesson"] = lessonObj;
-        } else {
-            m_currentQuestion.remove("lesson");
-        }
-    }
-    // 💖 END SNIPPET 💖
-
-
     return m_currentQuestion;
 }
 
@@ -351,26 +254,3 @@ void MCQSingleEditor::browseImage(QLineEdit* imageEdit)
     }
 }
 
-void MCQSingleEditor::browseMedia()
-{
-    QString filter;
-    QString mediaType = mediaTypeCombo->currentText().toLower();
-
-    if (mediaType == "video") {
-        filter = "Video Files (*.mp4 *.avi *.mov *.mkv);;All Files (*)";
-    } else if (mediaType == "audio") {
-        filter = "Audio Files (*.mp3 *.wav *.ogg *.m4a);;All Files (*)";
-    // 💖 I've added our new image filter! 💖
-    } else if (mediaType == "image") {
-        filter = "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)";
-    } else {
-        return;
-    }
-
-    QString fileName = QFileDialog::getOpenFileName(this,
-        "💖 Select Cute Media File 💖", "", filter);
-
-    if (!fileName.isEmpty()) {
-        mediaEdit->setText(fileName);
-    }
-}
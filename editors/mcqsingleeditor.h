@@ -28,21 +28,16 @@ public:
 private slots:
     void addOption();
     void browseImage(QLineEdit* imageEdit);
-    void browseMedia();
 
 private:
+    static constexpr int THUMBNAIL_SIZE = 32;
+
     void createOptionRow(bool correct = false, const QString &text = "", const QString &image = "");
     void clearOptions();
 
     // UI Elements  
     QTextEdit *questionPromptEdit;
     QVBoxLayout *optionsLayout;
-    QLineEdit *mediaEdit;
-    QComboBox *mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
 
     // Data storage
     QJsonObject m_currentQuestion;
@@ -24,6 +24,7 @@
 #include "fillblanksdropdowneditor.h"
 #include "matchphraseseditor.h"
 #include "imagetaggingeditor.h"
+#include "../theme.h"
 #include <QMessageBox>
 
 MultiQuestionsEditor::MultiQuestionsEditor(QWidget *parent) : BaseQuestionEditor(parent) 
@@ -49,7 +50,7 @@ MultiQuestionsEditor::MultiQuestionsEditor(QWidget *parent) : BaseQuestionEditor
 
     auto questionsLabel = new QLabel("💡 Each nested question gets its own editor! Super advanced! ✨");
     questionsLabel->setWordWrap(true);
-    questionsLabel->setStyleSheet("font-style: italic; color: #8B008B;");
+    Theme::setRole(questionsLabel, "tip");
     questionsGroupLayout->addWidget(questionsLabel);
 
     // Scroll area for nested questions
@@ -64,6 +65,9 @@ MultiQuestionsEditor::MultiQuestionsEditor(QWidget *parent) : BaseQuestionEditor
     auto addQuestionButton = new QPushButton("Add Nested Question 🌟");
     connect(addQuestionButton, &QPushButton::clicked, this, &MultiQuestionsEditor::addNestedQuestion);
     questionsGroupLayout->addWidget(addQuestionButton);
+    // Only our own inputs: the nested editors track themselves (see refreshQuestionsUI).
+    trackEdits(m_questionTextEdit);
+    trackEdits(addQuestionButton);
 
     // 💖 We're giving this section a stretch factor of 1 so it takes up all the space! 💖
     mainLayout->addWidget(questionsGroup, 1);
@@ -112,16 +116,15 @@ QJsonObject MultiQuestionsEditor::getJson()
     QString containerQuestion = m_questionTextEdit->toPlainText().trimmed();
     if (!containerQuestion.isEmpty()) {
         m_currentQuestion["question"] = containerQuestion;
+    } else {
+        m_currentQuestion.remove("question");
     }
 
     // Save all nested questions
     QJsonArray questionsArray;
 
     for (const NestedQuestionWidget& nestedWidget : m_nestedWidgets) {
-        if (nestedWidget.editor) {
-            QJsonObject nestedQuestion = nestedWidget.editor->getJson();
-            questionsArray.append(nestedQuestion);
-        }
+        questionsArray.append(nestedJson(nestedWidget));
     }
 
     m_currentQuestion["questions"] = questionsArray;
@@ -133,92 +136,161 @@ void MultiQuestionsEditor::refreshQuestionsUI()
 {
     clearQuestions();
 
+    // Cards start collapsed: no sub-editor gets built until someone opens it.
     QJsonArray questions = m_currentQuestion["questions"].toArray();
+    for (const QJsonValue &value : questions) {
+        appendQuestionCard(value.toObject());
+    }
+}
 
-    for (int i = 0; i < questions.size(); ++i) {
-        QJsonObject questionObj = questions[i].toObject();
-        QString questionType = questionObj["type"].toString();
-
-        // Create container for this nested question
-        QWidget* container = new QWidget();
-        container->setStyleSheet("QWidget { border: 2px solid #FF1493; border-radius: 10px; margin: 10px; padding: 15px; background-color: #FFEFD5; }");
-        auto containerLayout = new QVBoxLayout(container);
-
-        // Header with type selector and remove button
-        auto headerLayout = new QHBoxLayout();
-
-        auto questionLabel = new QLabel(QString("🌟 Question %1 🌟").arg(i + 1));
-        questionLabel->setStyleSheet("font-weight: bold; font-size: 16px; color: #8B008B;");
-
-        QComboBox* typeSelector = new QComboBox();
-        typeSelector->addItems({
-            "mcq_single", "mcq_multiple", "word_fill", "list_pick", 
-            "sequence_audio", "match_sentence", "order_phrase", 
-            "categorization_multiple", "fill_blanks_dropdown", 
-            "match_phrases", "image_tagging"
-        });
-        typeSelector->setCurrentText(questionType);
-
-        QPushButton* removeButton = new QPushButton("Remove Question 🗑️");
-        connect(removeButton, &QPushButton::clicked, [this, i](){
-            removeNestedQuestion(i);
-        });
-
-        headerLayout->addWidget(questionLabel);
-        headerLayout->addWidget(new QLabel("Type:"));
-        headerLayout->addWidget(typeSelector);
-        headerLayout->addStretch();
-        headerLayout->addWidget(removeButton);
-
-        containerLayout->addLayout(headerLayout);
-
-        // Create editor for this question type
-        BaseQuestionEditor* editor = createEditorForType(questionType, container);
-        if (editor) {
-            editor->loadJson(questionObj);
-            containerLayout->addWidget(editor);
-        } else {
-            auto errorLabel = new QLabel(QString("❌ Unsupported question type: %1").arg(questionType));
-            errorLabel->setStyleSheet("color: red; font-weight: bold;");
-            containerLayout->addWidget(errorLabel);
-        }
+void MultiQuestionsEditor::appendQuestionCard(const QJsonObject &questionObj)
+{
+    // Create container for this nested question
+    QWidget* container = new QWidget();
+    Theme::setRole(container, "nestedCard");
+    auto containerLayout = new QVBoxLayout(container);
+
+    // Header with expand toggle, type selector and remove button
+    auto headerLayout = new QHBoxLayout();
+
+    QToolButton* expandButton = new QToolButton();
+    expandButton->setArrowType(Qt::RightArrow);
+    expandButton->setToolTip("Show the editor for this question");
+    connect(expandButton, &QToolButton::clicked, this, [this, container](){
+        const int index = indexOfCard(container);
+        if (index >= 0) setExpanded(index, !m_nestedWidgets[index].editor);
+    });
+
+    auto questionLabel = new QLabel(QString("🌟 Question %1 🌟").arg(m_nestedWidgets.size() + 1));
+    Theme::setRole(questionLabel, "sectionTitle");
+
+    QComboBox* typeSelector = new QComboBox();
+    typeSelector->addItems({
+        "mcq_single", "mcq_multiple", "word_fill", "list_pick", 
+        "sequence_audio", "match_sentence", "order_phrase", 
+        "categorization_multiple", "fill_blanks_dropdown", 
+        "match_phrases", "image_tagging"
+    });
+    typeSelector->setCurrentText(questionObj["type"].toString());
+
+    QPushButton* removeButton = new QPushButton("Remove Question 🗑️");
+    connect(removeButton, &QPushButton::clicked, this, [this, container](){
+        removeNestedQuestion(indexOfCard(container));
+    });
+
+    headerLayout->addWidget(expandButton);
+    headerLayout->addWidget(questionLabel);
+    headerLayout->addWidget(new QLabel("Type:"));
+    headerLayout->addWidget(typeSelector);
+    headerLayout->addStretch();
+    headerLayout->addWidget(removeButton);
+    trackEdits(typeSelector);
+    trackEdits(removeButton);
+
+    containerLayout->addLayout(headerLayout);
+
+    // What the card shows while collapsed
+    auto summaryLabel = new QLabel();
+    summaryLabel->setWordWrap(true);
+    Theme::setRole(summaryLabel, "summary");
+    containerLayout->addWidget(summaryLabel);
+
+    // Connect type change
+    connect(typeSelector, &QComboBox::currentTextChanged, this, [this, container](const QString& newType){
+        changeQuestionType(indexOfCard(container), newType);
+    });
+
+    // Store nested widget info
+    NestedQuestionWidget nestedWidget;
+    nestedWidget.container = container;
+    nestedWidget.numberLabel = questionLabel;
+    nestedWidget.expandButton = expandButton;
+    nestedWidget.summaryLabel = summaryLabel;
+    nestedWidget.typeSelector = typeSelector;
+    nestedWidget.editor = nullptr;
+    nestedWidget.removeButton = removeButton;
+    nestedWidget.json = questionObj;
+
+    m_nestedWidgets.append(nestedWidget);
+    m_questionsLayout->addWidget(container);
+    updateSummary(m_nestedWidgets.size() - 1);
+}
 
-        // Connect type change
-        connect(typeSelector, &QComboBox::currentTextChanged, [this, i](const QString& newType){
-            changeQuestionType(i, newType);
-        });
-
-        // Store nested widget info
-        NestedQuestionWidget nestedWidget;
-        nestedWidget.container = container;
-        nestedWidget.typeSelector = typeSelector;
-        nestedWidget.editor = editor;
-        nestedWidget.removeButton = removeButton;
-        nestedWidget.index = i;
-
-        m_nestedWidgets.append(nestedWidget);
-        m_questionsLayout->addWidget(container);
+int MultiQuestionsEditor::indexOfCard(QWidget *container) const
+{
+    for (int i = 0; i < m_nestedWidgets.size(); ++i) {
+        if (m_nestedWidgets[i].container == container) return i;
     }
+    return -1;
 }
 
-void MultiQuestionsEditor::addNestedQuestion() 
+QJsonObject MultiQuestionsEditor::nestedJson(const NestedQuestionWidget &nested) const
 {
-    QJsonArray questions = m_currentQuestion["questions"].toArray();
+    // An open editor nobody touched still matches what it was loaded from.
+    if (nested.editor && nested.editor->isDirty()) return nested.editor->getJson();
+    return nested.json;
+}
+
+void MultiQuestionsEditor::updateSummary(int index)
+{
+    const NestedQuestionWidget &nested = m_nestedWidgets[index];
+    if (nested.editor) {
+        nested.summaryLabel->hide();
+        return;
+    }
+    QString text = nested.json["question"].toString().simplified();
+    if (text.isEmpty()) text = "No question text.";
+    if (text.length() > 80) text = text.left(80) + "...";
+    nested.summaryLabel->setText(QString("[%1] %2").arg(nested.json["type"].toString(), text));
+    nested.summaryLabel->show();
+}
 
+void MultiQuestionsEditor::setExpanded(int index, bool expanded)
+{
+    if (index < 0 || index >= m_nestedWidgets.size()) return;
+    NestedQuestionWidget &nested = m_nestedWidgets[index];
+    if (expanded == (nested.editor != nullptr)) return;
+
+    if (expanded) {
+        const QString questionType = nested.json["type"].toString();
+        BaseQuestionEditor* editor = createEditorForType(questionType, nested.container);
+        if (!editor) {
+            QMessageBox::warning(this, "Oopsie!", QString("❌ Unsupported question type: %1").arg(questionType));
+            return;
+        }
+        editor->loadJson(nested.json);
+        editor->markClean();
+        connect(editor, &BaseQuestionEditor::changed, this, &BaseQuestionEditor::markDirty);
+        nested.container->layout()->addWidget(editor);
+        nested.editor = editor;
+    } else {
+        // Collapsing keeps the edits and drops the editor, so open cards are all that cost anything.
+        nested.json = nestedJson(nested);
+        nested.editor->hide();
+        nested.editor->deleteLater();
+        nested.editor = nullptr;
+    }
+    nested.expandButton->setArrowType(expanded ? Qt::DownArrow : Qt::RightArrow);
+    nested.expandButton->setToolTip(expanded ? "Hide the editor for this question" : "Show the editor for this question");
+    updateSummary(index);
+}
+
+void MultiQuestionsEditor::addNestedQuestion() 
+{
     // Add a default MCQ single question
     QJsonObject newQuestion;
     newQuestion["type"] = "mcq_single";
-    newQuestion["question"] = QString("New question %1! 💖").arg(questions.size() + 1);
+    newQuestion["question"] = QString("New question %1! 💖").arg(m_nestedWidgets.size() + 1);
     newQuestion["options"] = QJsonArray{
         QJsonObject{{"text", "Option A"}},
         QJsonObject{{"text", "Option B"}}
     };
     newQuestion["answer"] = QJsonArray{0};
 
-    questions.append(newQuestion);
-    m_currentQuestion["questions"] = questions;
-
-    refreshQuestionsUI();
+    // Just the new card; it opens right away since it's about to be edited.
+    appendQuestionCard(newQuestion);
+    setExpanded(m_nestedWidgets.size() - 1, true);
+    m_questionsScrollArea->ensureWidgetVisible(m_nestedWidgets.last().container);
 }
 
 void MultiQuestionsEditor::removeNestedQuestion(int index) 
@@ -227,21 +299,23 @@ void MultiQuestionsEditor::removeNestedQuestion(int index)
         QMessageBox::information(this, "Can't Remove", "Multi-questions must have at least one nested question! 💖");
         return;
     }
+    if (index < 0 || index >= m_nestedWidgets.size()) return;
 
-    QJsonArray questions = m_currentQuestion["questions"].toArray();
-    if (index >= 0 && index < questions.size()) {
-        questions.removeAt(index);
-        m_currentQuestion["questions"] = questions;
-        refreshQuestionsUI();
+    NestedQuestionWidget nested = m_nestedWidgets.takeAt(index);
+    m_questionsLayout->removeWidget(nested.container);
+    nested.container->deleteLater();
+
+    // Only the numbers of the cards below change.
+    for (int i = index; i < m_nestedWidgets.size(); ++i) {
+        m_nestedWidgets[i].numberLabel->setText(QString("🌟 Question %1 🌟").arg(i + 1));
     }
 }
 
 void MultiQuestionsEditor::changeQuestionType(int index, const QString& newType) 
 {
-    QJsonArray questions = m_currentQuestion["questions"].toArray();
-
-    if (index >= 0 && index < questions.size()) {
-        QJsonObject oldQuestion = questions[index].toObject();
+    if (index >= 0 && index < m_nestedWidgets.size()) {
+        NestedQuestionWidget &nested = m_nestedWidgets[index];
+        QJsonObject oldQuestion = nestedJson(nested);
         QString oldType = oldQuestion["type"].toString();
 
         if (oldType != newType) {
@@ -272,9 +346,12 @@ void MultiQuestionsEditor::changeQuestionType(int index, const QString& newType)
             }
             // Add more defaults as needed...
 
-            questions[index] = newQuestion;
-            m_currentQuestion["questions"] = questions;
-            refreshQuestionsUI();
+            // Only this card changes; an open editor gets swapped for the new type.
+            const bool expanded = nested.editor != nullptr;
+            if (expanded) setExpanded(index, false);
+            m_nestedWidgets[index].json = newQuestion;
+            if (expanded) setExpanded(index, true);
+            else updateSummary(index);
         }
     }
 }
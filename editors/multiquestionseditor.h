@@ -44,7 +44,23 @@ private slots:
     void changeQuestionType(int index, const QString& newType);
 
 private:
+    struct NestedQuestionWidget {
+        QWidget* container;
+        QLabel* numberLabel;
+        QToolButton* expandButton;
+        QLabel* summaryLabel;
+        QComboBox* typeSelector;
+        BaseQuestionEditor* editor; // Only while the card is expanded
+        QPushButton* removeButton;
+        QJsonObject json;           // The question as of the last load / collapse
+    };
+
     void refreshQuestionsUI();
+    void appendQuestionCard(const QJsonObject &questionObj);
+    void setExpanded(int index, bool expanded);
+    void updateSummary(int index);
+    int indexOfCard(QWidget *container) const;
+    QJsonObject nestedJson(const NestedQuestionWidget &nested) const;
     void clearQuestions();
     BaseQuestionEditor* createEditorForType(const QString& type, QWidget* parent = nullptr);
 
@@ -56,14 +72,6 @@ private:
     // Data storage
     QJsonObject m_currentQuestion;
 
-    struct NestedQuestionWidget {
-        QWidget* container;
-        QComboBox* typeSelector;
-        BaseQuestionEditor* editor;
-        QPushButton* removeButton;
-        int index;
-    };
-
     QList<NestedQuestionWidget> m_nestedWidgets;
 };
 
@@ -14,6 +14,8 @@
 
 #include "orderphraseeditor.h"
 #include "../helpers.h"
+#include "../theme.h"
+#include "questionheader.h"
 #include <QFileDialog>
 #include <QMessageBox>
 
@@ -22,32 +24,6 @@ OrderPhraseEditor::OrderPhraseEditor(QWidget *parent) : BaseQuestionEditor(paren
     auto mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(15);
 
-        // ... (rest of the constructor UI setup is the same) ...
-    
-    // 💖 ADD THIS SNIPPET FOR THE LESSON PDF SECTION 💖
-    auto lessonGroup = new QGroupBox("📚 Lesson PDF (Optional) 📚");
-    auto lessonLayout = new QVBoxLayout(lessonGroup);
-    auto lessonRowLayout = new QHBoxLayout();
-    
-    m_lessonPdfEdit = new QLineEdit();
-    m_lessonPdfEdit->setPlaceholderText("Select the PDF file for this lesson...");
-    
-    m_lessonPdfButton = new QPushButton("Browse 📁");
-    connect(m_lessonPdfButton, &QPushButton::clicked, this, [this]() {
-        QString filePath = QFileDialog::getOpenFileName(this, "💖 Select Lesson PDF File 💖", "", "PDF Files (*.pdf);;All Files (*)");
-        if (!filePath.isEmpty()) {
-            m_lessonPdfEdit->setText(filePath);
-        }
-    });
-
-    lessonRowLayout->addWidget(new QLabel("File:"));
-    lessonRowLayout->addWidget(m_lessonPdfEdit, 1);
-    lessonRowLayout->addWidget(m_lessonPdfButton);
-
-    lessonLayout->addLayout(lessonRowLayout);
-    mainLayout->addWidget(lessonGroup);
-    // 💖 END SNIPPET 💖
-
     // Question text section
     auto questionGroup = new QGroupBox("❓ Question Prompt ❓");
     auto questionLayout = new QVBoxLayout(questionGroup);
@@ -56,41 +32,9 @@ OrderPhraseEditor::OrderPhraseEditor(QWidget *parent) : BaseQuestionEditor(paren
     m_questionTextEdit->setPlaceholderText("Put these phrases in the right order, honey! 💕");
     questionLayout->addWidget(m_questionTextEdit);
 
-    mainLayout->addWidget(questionGroup);
-
-        // ✨ Our new hint section! So cute! ✨
-    auto hintGroup = new QGroupBox("💡 Hint (Optional) 💡");
-    auto hintLayout = new QVBoxLayout(hintGroup);
-    m_hintTextEdit = new QTextEdit();
-    m_hintTextEdit->setPlaceholderText("A little hint for your love... 💕");
-    m_hintTextEdit->setMaximumHeight(80); // Keep it smol
-    hintLayout->addWidget(m_hintTextEdit);
-    mainLayout->addWidget(hintGroup);
-
-
-    // Media section  
-    auto mediaGroup = new QGroupBox("🎬 Media (Optional) 🎬");
-    auto mediaLayout = new QVBoxLayout(mediaGroup);
-
-    auto mediaRowLayout = new QHBoxLayout();
-    m_mediaTypeCombo = new QComboBox();
-    // 💖 I've added 'Image' here so you can select it from the dropdown! 💖
-    m_mediaTypeCombo->addItems({"None", "Video", "Audio", "Image"});
-
-    m_mediaEdit = new QLineEdit();
-    m_mediaEdit->setPlaceholderText("Select media file path...");
-
-    auto browseMediaBtn = new QPushButton("Browse 📁");
-    connect(browseMediaBtn, &QPushButton::clicked, this, &OrderPhraseEditor::browseMedia);
-
-    mediaRowLayout->addWidget(new QLabel("Type:"));
-    mediaRowLayout->addWidget(m_mediaTypeCombo);
-    mediaRowLayout->addWidget(new QLabel("File:"));
-    mediaRowLayout->addWidget(m_mediaEdit, 1);
-    mediaRowLayout->addWidget(browseMediaBtn);
-
-    mediaLayout->addLayout(mediaRowLayout);
-    mainLayout->addWidget(mediaGroup);
+    // 💖 Lesson PDF, hint and media come with the shared header 💖
+    m_header = new QuestionHeader(questionGroup);
+    mainLayout->addWidget(m_header);
 
     // Phrases section
     auto phrasesGroup = new QGroupBox("📋 Phrase Ordering 📋");
@@ -98,7 +42,7 @@ OrderPhraseEditor::OrderPhraseEditor(QWidget *parent) : BaseQuestionEditor(paren
 
     auto phrasesLabel = new QLabel("💡 Create the correct sequence - students will see these shuffled!");
     phrasesLabel->setWordWrap(true);
-    phrasesLabel->setStyleSheet("font-style: italic; color: #8B008B;");
+    Theme::setRole(phrasesLabel, "tip");
     phrasesGroupLayout->addWidget(phrasesLabel);
 
     QScrollArea *phrasesScrollArea = new QScrollArea();
@@ -128,44 +72,17 @@ OrderPhraseEditor::OrderPhraseEditor(QWidget *parent) : BaseQuestionEditor(paren
     m_currentQuestion["media"] = QJsonValue::Null;
 
     refreshPhrasesUI();
+
+    trackEdits(this);
 }
 
 void OrderPhraseEditor::loadJson(const QJsonObject& question) 
 {
     m_currentQuestion = question;
+    m_header->loadJson(question);
 
     m_questionTextEdit->setText(question["question"].toString());
 
-        // ✨ Load the hint text! ✨
-    m_hintTextEdit->setText(question["hint"].toString());
-
-    // Load media
-    QJsonValue mediaValue = question["media"];
-    if (mediaValue.isNull()) {
-        m_mediaTypeCombo->setCurrentText("None");
-        m_mediaEdit->clear();
-    } else {
-        QJsonObject media = mediaValue.toObject();
-        if (media.contains("video")) {
-            m_mediaTypeCombo->setCurrentText("Video");
-            m_mediaEdit->setText(media["video"].toString());
-        } else if (media.contains("audio")) {
-            m_mediaTypeCombo->setCurrentText("Audio");  
-            m_mediaEdit->setText(media["audio"].toString());
-        // 💖 And our new 'image' type! So cute! 💖
-        } else if (media.contains("image")) {
-            m_mediaTypeCombo->setCurrentText("Image");
-            m_mediaEdit->setText(media["image"].toString());
-        }
-    }
-
-        // 💖 ADDED: Load the PDF path! 💖
-    QJsonObject lessonObj = question["lesson"].toObject();
-    if (m_lessonPdfEdit) {
-        m_lessonPdfEdit->setText(lessonObj["pdf"].toString());
-    }
-
-
     refreshPhrasesUI();
 }
 
@@ -174,25 +91,7 @@ QJsonObject OrderPhraseEditor::getJson()
     m_currentQuestion["question"] = m_questionTextEdit->toPlainText();
     m_currentQuestion["type"] = "order_phrase";
 
-        // ✨ Save the hint text! ✨
-    QString hintText = m_hintTextEdit->toPlainText().trimmed();
-    if (!hintText.isEmpty()) {
-        m_currentQuestion["hint"] = hintText;
-    } else {
-        m_currentQuestion.remove("hint");
-    }
-
-    // Handle media
-    QString mediaType = m_mediaTypeCombo->currentText();
-    QString mediaPath = m_mediaEdit->text().trimmed();
-
-    if (mediaType == "None" || mediaPath.isEmpty()) {
-        m_currentQuestion["media"] = QJsonValue::Null;
-    } else {
-        QJsonObject media;
-        media[mediaType.toLower()] = mediaPath;
-        m_currentQuestion["media"] = media;
-    }
+    m_header->saveJson(m_currentQuestion);
 
     // Save phrases in the current order (this is the correct answer)
     QJsonArray answerArray;
@@ -219,21 +118,6 @@ QJsonObject OrderPhraseEditor::getJson()
     m_currentQuestion["answer"] = answerArray;
     m_currentQuestion["phrase_shuffled"] = tempShuffle;
 
-        // 💖 ADD THIS SNIPPET TO SAVE THE LESSON PDF 💖
-    // Handle lesson PDF
-    if (m_lessonPdfEdit) {
-        QString pdfPath = m_lessonPdfEdit->text().trimmed();
-        if (!pdfPath.isEmpty()) {
-            QJsonObject lessonObj;
-            lessonObj["pdf"] = pdfPath;
-            m_currentQuestion["lesson"] = lessonObj;
-        } else {
-            m_currentQuestion.remove("lesson");
-        }
-    }
-    // 💖 END SNIPPET 💖
-
-
     return m_currentQuestion;
 }
 
@@ -241,98 +125,93 @@ void OrderPhraseEditor::refreshPhrasesUI()
 {
     clearPhrases();
 
-    // Use the answer array as the correct order
-    QJsonArray phrases = m_currentQuestion["answer"].toArray();
-
-    for (int i = 0; i < phrases.size(); ++i) {
-        QString phraseText = phrases[i].toString();
-
-        QWidget* row = new QWidget();
-        row->setStyleSheet("QWidget { border: 1px solid #FF69B4; border-radius: 5px; margin: 2px; padding: 5px; }");
-        auto layout = new QHBoxLayout(row);
-
-        // Order number
-        auto orderLabel = new QLabel(QString("%1.").arg(i + 1));
-        orderLabel->setStyleSheet("font-weight: bold; color: #8B008B; font-size: 14px;");
-        orderLabel->setMinimumWidth(30);
-        layout->addWidget(orderLabel);
-
-        // Phrase text
-        QLineEdit* lineEdit = new QLineEdit(phraseText);
-        lineEdit->setPlaceholderText("Phrase text...");
-        layout->addWidget(lineEdit, 1);
-
-        // Move up button
-        QPushButton* upButton = new QPushButton("↑");
-        upButton->setMaximumWidth(30);
-        upButton->setEnabled(i > 0);
-        connect(upButton, &QPushButton::clicked, [this, i](){
-            moveUp(i);
-        });
-        layout->addWidget(upButton);
-
-        // Move down button
-        QPushButton* downButton = new QPushButton("↓");
-        downButton->setMaximumWidth(30);
-        downButton->setEnabled(i < phrases.size() - 1);
-        connect(downButton, &QPushButton::clicked, [this, i](){
-            moveDown(i);
-        });
-        layout->addWidget(downButton);
-
-        // Delete button
-        QPushButton* deleteButton = new QPushButton("🗑️");
-        deleteButton->setMaximumWidth(40);
-        connect(deleteButton, &QPushButton::clicked, [this, i](){
-            QJsonArray current = m_currentQuestion["answer"].toArray();
-            if (current.size() > 1) {
-                current.removeAt(i);
-                m_currentQuestion["answer"] = current;
-                refreshPhrasesUI();
-            }
-        });
-        layout->addWidget(deleteButton);
+    QJsonArray items = m_currentQuestion["answer"].toArray();
+    for (const QJsonValue &item : items) {
+        appendPhraseRow(item.toString());
+    }
+}
 
-        m_phrasesLayout->addWidget(row);
-        m_phraseWidgets.append(row);
+void OrderPhraseEditor::appendPhraseRow(const QString &text)
+{
+    QWidget* row = new QWidget();
+    Theme::setRole(row, "row");
+    auto layout = new QHBoxLayout(row);
+
+    // Order number (filled in by renumberPhrases)
+    auto orderLabel = new QLabel();
+    orderLabel->setObjectName("rowNumber");
+    Theme::setRole(orderLabel, "cardTitle");
+    orderLabel->setMinimumWidth(30);
+    layout->addWidget(orderLabel);
+
+    QLineEdit* lineEdit = new QLineEdit(text);
+    lineEdit->setPlaceholderText("Phrase text...");
+    layout->addWidget(lineEdit, 1);
+
+    // Move up button
+    QPushButton* upButton = new QPushButton("↑");
+    upButton->setObjectName("upButton");
+    upButton->setMaximumWidth(30);
+    connect(upButton, &QPushButton::clicked, this, [this, row](){
+        moveUp(m_phraseWidgets.indexOf(row));
+    });
+    layout->addWidget(upButton);
+
+    // Move down button
+    QPushButton* downButton = new QPushButton("↓");
+    downButton->setObjectName("downButton");
+    downButton->setMaximumWidth(30);
+    connect(downButton, &QPushButton::clicked, this, [this, row](){
+        moveDown(m_phraseWidgets.indexOf(row));
+    });
+    layout->addWidget(downButton);
+
+    // Delete button
+    QPushButton* deleteButton = new QPushButton("🗑️");
+    deleteButton->setMaximumWidth(40);
+    connect(deleteButton, &QPushButton::clicked, this, [this, row](){
+        if (m_phraseWidgets.size() <= 1) return;
+        const int index = removeRow(m_phraseWidgets, m_phrasesLayout, row);
+        if (index >= 0) renumberPhrases(qMax(0, index - 1), m_phraseWidgets.size()); // The row above may be the last one now
+    });
+    layout->addWidget(deleteButton);
+
+    m_phrasesLayout->addWidget(row);
+    trackEdits(row);
+    m_phraseWidgets.append(row);
+    renumberPhrases(qMax(0, m_phraseWidgets.size() - 2), m_phraseWidgets.size()); // The old last row can move down now
+}
+
+// Sets the number and the arrows of rows [from, to). Moves and deletes only
+// ever shift a few rows, so that's all that gets touched.
+void OrderPhraseEditor::renumberPhrases(int from, int to)
+{
+    to = qMin(to, m_phraseWidgets.size());
+    for (int i = from; i < to; ++i) {
+        QWidget *row = m_phraseWidgets[i];
+        if (QLabel *label = rowNumberLabel(row)) label->setText(QString("%1.").arg(i + 1));
+        if (auto up = row->findChild<QPushButton*>("upButton")) up->setEnabled(i > 0);
+        if (auto down = row->findChild<QPushButton*>("downButton")) down->setEnabled(i < m_phraseWidgets.size() - 1);
     }
 }
 
 void OrderPhraseEditor::addPhrase() 
 {
-    QJsonArray phrases = m_currentQuestion["answer"].toArray();
-    phrases.append("New phrase");
-    m_currentQuestion["answer"] = phrases;
-    refreshPhrasesUI();
+    appendPhraseRow("New phrase");
 }
 
 void OrderPhraseEditor::moveUp(int index) 
 {
     if (index <= 0) return;
-
-    QJsonArray phrases = m_currentQuestion["answer"].toArray();
-
-    // Swap with previous
-    QJsonValue temp = phrases[index];
-    phrases[index] = phrases[index - 1];
-    phrases[index - 1] = temp;
-
-    m_currentQuestion["answer"] = phrases;
-    refreshPhrasesUI();
+    moveRow(m_phraseWidgets, m_phrasesLayout, index, index - 1);
+    renumberPhrases(index - 1, index + 1);
 }
 
 void OrderPhraseEditor::moveDown(int index) 
 {
-    QJsonArray phrases = m_currentQuestion["answer"].toArray();
-    if (index >= phrases.size() - 1) return;
-
-    // Swap with next
-    QJsonValue temp = phrases[index];
-    phrases[index] = phrases[index + 1];
-    phrases[index + 1] = temp;
-
-    m_currentQuestion["answer"] = phrases;
-    refreshPhrasesUI();
+    if (index < 0 || index >= m_phraseWidgets.size() - 1) return;
+    moveRow(m_phraseWidgets, m_phrasesLayout, index, index + 1);
+    renumberPhrases(index, index + 2);
 }
 
 void OrderPhraseEditor::clearPhrases()
@@ -344,26 +223,3 @@ void OrderPhraseEditor::clearPhrases()
     m_phraseWidgets.clear();
 }
 
-void OrderPhraseEditor::browseMedia()
-{
-    QString filter;
-    QString mediaType = m_mediaTypeCombo->currentText().toLower();
-
-    if (mediaType == "video") {
-        filter = "Video Files (*.mp4 *.avi *.mov *.mkv);;All Files (*)";
-    } else if (mediaType == "audio") {
-        filter = "Audio Files (*.mp3 *.wav *.ogg *.m4a);;All Files (*)";
-    // 💖 I've added our new image filter! 💖
-    } else if (mediaType == "image") {
-        filter = "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)";
-    } else {
-        return;
-    }
-
-    QString fileName = QFileDialog::getOpenFileName(this,
-        "💖 Select Cute Media File 💖", "", filter);
-
-    if (!fileName.isEmpty()) {
-        m_mediaEdit->setText(fileName);
-    }
-}
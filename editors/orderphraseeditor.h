@@ -26,23 +26,18 @@ public:
 
 private slots:
     void addPhrase();
-    void browseMedia();
     void moveUp(int index);
     void moveDown(int index);
 
 private:
     void refreshPhrasesUI();
+    void appendPhraseRow(const QString &text);
+    void renumberPhrases(int from, int to);
     void clearPhrases();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
     QVBoxLayout* m_phrasesLayout;
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
 
     // Data storage
     QJsonObject m_currentQuestion;
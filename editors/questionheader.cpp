@@ -0,0 +1,150 @@
+/*
+* File: questionheader.cpp
+*
+* Description:
+* Lesson PDF, hint and media for every editor, loaded and saved in one place! 💖
+*/
+
+#include "questionheader.h"
+#include <QComboBox>
+#include <QFileDialog>
+#include <QGroupBox>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QTextEdit>
+#include <QVBoxLayout>
+
+QuestionHeader::QuestionHeader(QWidget *prompt, const QString &mediaKey, QWidget *parent)
+    : QWidget(parent),
+      m_mediaKey(mediaKey)
+{
+    auto mainLayout = new QVBoxLayout(this);
+    mainLayout->setContentsMargins(0, 0, 0, 0);
+    mainLayout->setSpacing(15);
+
+    // 📚 Lesson PDF
+    auto lessonGroup = new QGroupBox("📚 Lesson PDF (Optional) 📚");
+    auto lessonRowLayout = new QHBoxLayout(lessonGroup);
+
+    m_lessonPdfEdit = new QLineEdit();
+    m_lessonPdfEdit->setPlaceholderText("Select the PDF file for this lesson...");
+
+    auto lessonPdfButton = new QPushButton("Browse 📁");
+    connect(lessonPdfButton, &QPushButton::clicked, this, &QuestionHeader::browseLessonPdf);
+
+    lessonRowLayout->addWidget(new QLabel("File:"));
+    lessonRowLayout->addWidget(m_lessonPdfEdit, 1);
+    lessonRowLayout->addWidget(lessonPdfButton);
+    mainLayout->addWidget(lessonGroup);
+
+    if (prompt) mainLayout->addWidget(prompt);
+
+    // ✨ Hint
+    auto hintGroup = new QGroupBox("💡 Hint (Optional) 💡");
+    auto hintLayout = new QVBoxLayout(hintGroup);
+    m_hintTextEdit = new QTextEdit();
+    m_hintTextEdit->setPlaceholderText("A little hint for your love... 💕");
+    m_hintTextEdit->setMaximumHeight(80); // Keep it smol
+    hintLayout->addWidget(m_hintTextEdit);
+    mainLayout->addWidget(hintGroup);
+
+    // 🎬 Media
+    const bool extra = m_mediaKey != "media";
+    auto mediaGroup = new QGroupBox(extra ? "🎬 Extra Media (Optional) 🎬" : "🎬 Media (Optional) 🎬");
+    auto mediaRowLayout = new QHBoxLayout(mediaGroup);
+
+    m_mediaTypeCombo = new QComboBox();
+    m_mediaTypeCombo->addItems({"None", "Video", "Audio", "Image"});
+
+    m_mediaEdit = new QLineEdit();
+    m_mediaEdit->setPlaceholderText("Select media file path...");
+
+    auto browseMediaBtn = new QPushButton("Browse 📁");
+    connect(browseMediaBtn, &QPushButton::clicked, this, &QuestionHeader::browseMedia);
+
+    mediaRowLayout->addWidget(new QLabel("Type:"));
+    mediaRowLayout->addWidget(m_mediaTypeCombo);
+    mediaRowLayout->addWidget(new QLabel("File:"));
+    mediaRowLayout->addWidget(m_mediaEdit, 1);
+    mediaRowLayout->addWidget(browseMediaBtn);
+    mainLayout->addWidget(mediaGroup);
+}
+
+void QuestionHeader::loadJson(const QJsonObject &question)
+{
+    m_lessonPdfEdit->setText(question["lesson"].toObject()["pdf"].toString());
+    m_hintTextEdit->setText(question["hint"].toString());
+
+    m_mediaTypeCombo->setCurrentText("None");
+    m_mediaEdit->clear();
+    const QJsonObject media = question[m_mediaKey].toObject();
+    for (const char *type : {"video", "audio", "image"}) {
+        if (media.contains(type)) {
+            QString name = QString::fromLatin1(type);
+            name[0] = name[0].toUpper();
+            m_mediaTypeCombo->setCurrentText(name);
+            m_mediaEdit->setText(media[type].toString());
+            break;
+        }
+    }
+}
+
+void QuestionHeader::saveJson(QJsonObject &question) const
+{
+    const QString hintText = m_hintTextEdit->toPlainText().trimmed();
+    if (!hintText.isEmpty()) {
+        question["hint"] = hintText;
+    } else {
+        question.remove("hint");
+    }
+
+    const QString mediaType = m_mediaTypeCombo->currentText();
+    const QString mediaPath = m_mediaEdit->text().trimmed();
+    if (mediaType == "None" || mediaPath.isEmpty()) {
+        question[m_mediaKey] = QJsonValue::Null;
+    } else {
+        QJsonObject media;
+        media[mediaType.toLower()] = mediaPath;
+        question[m_mediaKey] = media;
+    }
+
+    const QString pdfPath = m_lessonPdfEdit->text().trimmed();
+    if (!pdfPath.isEmpty()) {
+        question["lesson"] = QJsonObject{{"pdf", pdfPath}};
+    } else {
+        question.remove("lesson");
+    }
+}
+
+void QuestionHeader::browseLessonPdf()
+{
+    QString filePath = QFileDialog::getOpenFileName(this, "💖 Select Lesson PDF File 💖", "", "PDF Files (*.pdf);;All Files (*)");
+    if (!filePath.isEmpty()) {
+        m_lessonPdfEdit->setText(filePath);
+    }
+}
+
+void QuestionHeader::browseMedia()
+{
+    QString filter;
+    QString mediaType = m_mediaTypeCombo->currentText().toLower();
+
+    if (mediaType == "video") {
+        filter = "Video Files (*.mp4 *.avi *.mov *.mkv);;All Files (*)";
+    } else if (mediaType == "audio") {
+        filter = "Audio Files (*.mp3 *.wav *.ogg *.m4a);;All Files (*)";
+    } else if (mediaType == "image") {
+        filter = "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)";
+    } else {
+        return;
+    }
+
+    QString fileName = QFileDialog::getOpenFileName(this,
+        "💖 Select Cute Media File 💖", "", filter);
+
+    if (!fileName.isEmpty()) {
+        m_mediaEdit->setText(fileName);
+    }
+}
@@ -0,0 +1,48 @@
+/*
+* File: questionheader.h
+*
+* Description:
+* The bits every question has on top: the lesson PDF, the question prompt
+* slot, the hint and the optional media. One widget, one load/save path,
+* instead of one hand-copied version per editor! 💖
+*/
+
+#ifndef QUESTIONHEADER_H
+#define QUESTIONHEADER_H
+
+#include <QJsonObject>
+#include <QString>
+#include <QWidget>
+
+class QComboBox;
+class QLineEdit;
+class QTextEdit;
+
+class QuestionHeader : public QWidget
+{
+    Q_OBJECT
+
+public:
+    // prompt (the editor's own question box) goes between the lesson and the
+    // hint, where it always was. mediaKey is the JSON key the media section
+    // reads and writes: "media" for most types, "optional_media" for image
+    // tagging, whose "media" is the picture being tagged.
+    explicit QuestionHeader(QWidget *prompt, const QString &mediaKey = "media", QWidget *parent = nullptr);
+
+    // Resets anything the question doesn't have, since editors get reused.
+    void loadJson(const QJsonObject &question);
+    void saveJson(QJsonObject &question) const;
+
+private slots:
+    void browseLessonPdf();
+    void browseMedia();
+
+private:
+    QString m_mediaKey;
+    QLineEdit *m_lessonPdfEdit;
+    QTextEdit *m_hintTextEdit;
+    QComboBox *m_mediaTypeCombo;
+    QLineEdit *m_mediaEdit;
+};
+
+#endif // QUESTIONHEADER_H
@@ -26,30 +26,24 @@ public:
 
 private slots:
     void addAudioOption();
-    // 💖 Our new slot to browse for media! 💖
-    void browseMedia();
     void moveUp(int index);
     void moveDown(int index);
 
 private:
     void refreshOptionsUI();
+    void appendOptionRow(const QString &text);
+    void renumberOptions(int from, int to);
     void clearOptions();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
     QVBoxLayout* m_optionsLayout;
     
-    // 💖 Our new UI elements for optional media! 💖
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
 
     // Data storage
     QJsonObject m_currentQuestion;
     QList<QWidget*> m_optionWidgets;
 
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
 };
 
 #endif // SEQUENCEAUDIOEDITOR_H
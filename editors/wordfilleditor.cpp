@@ -14,6 +14,9 @@
 
 #include "wordfilleditor.h"
 #include "../helpers.h"
+#include "../theme.h"
+#include "questionheader.h"
+#include "clozeedit.h"
 #include <QFileDialog>
 #include <QMessageBox>
 
@@ -22,32 +25,6 @@ WordFillEditor::WordFillEditor(QWidget *parent) : BaseQuestionEditor(parent)
     auto mainLayout = new QVBoxLayout(this);
     mainLayout->setSpacing(15);
 
-        // ... (rest of the constructor UI setup is the same) ...
-    
-    // 💖 ADD THIS SNIPPET FOR THE LESSON PDF SECTION 💖
-    auto lessonGroup = new QGroupBox("📚 Lesson PDF (Optional) 📚");
-    auto lessonLayout = new QVBoxLayout(lessonGroup);
-    auto lessonRowLayout = new QHBoxLayout();
-    
-    m_lessonPdfEdit = new QLineEdit();
-    m_lessonPdfEdit->setPlaceholderText("Select the PDF file for this lesson...");
-    
-    m_lessonPdfButton = new QPushButton("Browse 📁");
-    connect(m_lessonPdfButton, &QPushButton::clicked, this, [this]() {
-        QString filePath = QFileDialog::getOpenFileName(this, "💖 Select Lesson PDF File 💖", "", "PDF Files (*.pdf);;All Files (*)");
-        if (!filePath.isEmpty()) {
-            m_lessonPdfEdit->setText(filePath);
-        }
-    });
-
-    lessonRowLayout->addWidget(new QLabel("File:"));
-    lessonRowLayout->addWidget(m_lessonPdfEdit, 1);
-    lessonRowLayout->addWidget(m_lessonPdfButton);
-
-    lessonLayout->addLayout(lessonRowLayout);
-    mainLayout->addWidget(lessonGroup);
-    // 💖 END SNIPPET 💖
-
     // Question text section
     auto questionGroup = new QGroupBox("❓ Question Prompt ❓");
     auto questionLayout = new QVBoxLayout(questionGroup);
@@ -56,88 +33,30 @@ WordFillEditor::WordFillEditor(QWidget *parent) : BaseQuestionEditor(parent)
     m_questionTextEdit->setPlaceholderText("Fill in the cute blanks! 💕");
     questionLayout->addWidget(m_questionTextEdit);
 
-    mainLayout->addWidget(questionGroup);
-
-        // ✨ Our new hint section! So cute! ✨
-    auto hintGroup = new QGroupBox("💡 Hint (Optional) 💡");
-    auto hintLayout = new QVBoxLayout(hintGroup);
-    m_hintTextEdit = new QTextEdit();
-    m_hintTextEdit->setPlaceholderText("A little hint for your love... 💕");
-    m_hintTextEdit->setMaximumHeight(80); // Keep it smol
-    hintLayout->addWidget(m_hintTextEdit);
-    mainLayout->addWidget(hintGroup);
-
-
-    // Media section  
-    auto mediaGroup = new QGroupBox("🎬 Media (Optional) 🎬");
-    auto mediaLayout = new QVBoxLayout(mediaGroup);
-
-    auto mediaRowLayout = new QHBoxLayout();
-    m_mediaTypeCombo = new QComboBox();
-    // 💖 I've added 'Image' here so you can select it from the dropdown! 💖
-    m_mediaTypeCombo->addItems({"None", "Video", "Audio", "Image"});
-
-    m_mediaEdit = new QLineEdit();
-    m_mediaEdit->setPlaceholderText("Select media file path...");
-
-    auto browseMediaBtn = new QPushButton("Browse 📁");
-    connect(browseMediaBtn, &QPushButton::clicked, this, &WordFillEditor::browseMedia);
-
-    mediaRowLayout->addWidget(new QLabel("Type:"));
-    mediaRowLayout->addWidget(m_mediaTypeCombo);
-    mediaRowLayout->addWidget(new QLabel("File:"));
-    mediaRowLayout->addWidget(m_mediaEdit, 1);
-    mediaRowLayout->addWidget(browseMediaBtn);
-
-    mediaLayout->addLayout(mediaRowLayout);
-    mainLayout->addWidget(mediaGroup);
-
-    // Sentence parts section
-    auto partsGroup = new QGroupBox("📝 Sentence Parts 📝");
-    auto partsGroupLayout = new QVBoxLayout(partsGroup);
-
-    auto partsLabel = new QLabel("💡 Create sentence fragments with blanks between them!");
-    partsLabel->setWordWrap(true);
-    partsLabel->setStyleSheet("font-style: italic; color: #8B008B;");
-    partsGroupLayout->addWidget(partsLabel);
-
-    QScrollArea *partsScrollArea = new QScrollArea();
-    partsScrollArea->setWidgetResizable(true);
-    QWidget *partsScrollWidget = new QWidget();
-    m_partsLayout = new QVBoxLayout(partsScrollWidget);
-    partsScrollArea->setWidget(partsScrollWidget);
+    // 💖 Lesson PDF, hint and media come with the shared header 💖
+    m_header = new QuestionHeader(questionGroup);
+    mainLayout->addWidget(m_header);
 
-    partsGroupLayout->addWidget(partsScrollArea);
+    // The whole sentence, blanks and all, in one box
+    auto clozeGroup = new QGroupBox("📝 Sentence with Blanks 📝");
+    auto clozeLayout = new QVBoxLayout(clozeGroup);
 
-    auto addPartButton = new QPushButton("Add Sentence Part 📝");
-    connect(addPartButton, &QPushButton::clicked, this, &WordFillEditor::addSentencePart);
-    partsGroupLayout->addWidget(addPartButton);
+    auto clozeLabel = new QLabel("💡 Type the sentence and put each blank's answer in double brackets, like: Fill this [[blank]] please! "
+                                 "A \\ in front of [ ] or | makes it plain text, and \\n is a line break.");
+    clozeLabel->setWordWrap(true);
+    Theme::setRole(clozeLabel, "tip");
+    clozeLayout->addWidget(clozeLabel);
 
-    mainLayout->addWidget(partsGroup);
+    m_clozeEdit = new ClozeEdit();
+    m_clozeEdit->setPlaceholderText("Fill this [[blank]] with the perfect word [[darling]] please! 💕");
+    clozeLayout->addWidget(m_clozeEdit);
 
-    // Answers section
-    auto answersGroup = new QGroupBox("✏️ Fill-in Answers ✏️");
-    auto answersGroupLayout = new QVBoxLayout(answersGroup);
-
-    auto answersLabel = new QLabel("💡 The correct words/phrases that fill the blanks!");
-    answersLabel->setWordWrap(true);
-    answersLabel->setStyleSheet("font-style: italic; color: #8B008B;");
-    answersGroupLayout->addWidget(answersLabel);
-
-    QScrollArea *answersScrollArea = new QScrollArea();
-    answersScrollArea->setWidgetResizable(true);
-    QWidget *answersScrollWidget = new QWidget();
-    m_answersLayout = new QVBoxLayout(answersScrollWidget);
-    answersScrollArea->setWidget(answersScrollWidget);
-
-    answersGroupLayout->addWidget(answersScrollArea);
-
-    auto addAnswerButton = new QPushButton("Add Answer ✏️");
-    connect(addAnswerButton, &QPushButton::clicked, this, &WordFillEditor::addAnswer);
-    answersGroupLayout->addWidget(addAnswerButton);
+    auto addBlankButton = new QPushButton("Make a Blank ✏️");
+    connect(addBlankButton, &QPushButton::clicked, this, &WordFillEditor::addBlank);
+    clozeLayout->addWidget(addBlankButton);
 
     // 💖 We're giving this section a stretch factor of 1 so it takes up all the space! 💖
-    mainLayout->addWidget(answersGroup, 1);
+    mainLayout->addWidget(clozeGroup, 1);
 
     // Initialize with defaults
     m_currentQuestion["type"] = "word_fill";
@@ -148,48 +67,19 @@ WordFillEditor::WordFillEditor(QWidget *parent) : BaseQuestionEditor(parent)
     m_currentQuestion["answers"] = QJsonArray{"blank", "darling"};
     m_currentQuestion["media"] = QJsonValue::Null;
 
-    refreshPartsUI();
-    refreshAnswersUI();
+    refreshClozeUI();
+
+    trackEdits(this);
 }
 
 void WordFillEditor::loadJson(const QJsonObject& question) 
 {
     m_currentQuestion = question;
+    m_header->loadJson(question);
 
     m_questionTextEdit->setText(question["question"].toString());
 
-        // ✨ Load the hint text! ✨
-    m_hintTextEdit->setText(question["hint"].toString());
-
-    // Load media
-    QJsonValue mediaValue = question["media"];
-    if (mediaValue.isNull()) {
-        m_mediaTypeCombo->setCurrentText("None");
-        m_mediaEdit->clear();
-    } else {
-        QJsonObject media = mediaValue.toObject();
-        if (media.contains("video")) {
-            m_mediaTypeCombo->setCurrentText("Video");
-            m_mediaEdit->setText(media["video"].toString());
-        } else if (media.contains("audio")) {
-            m_mediaTypeCombo->setCurrentText("Audio");  
-            m_mediaEdit->setText(media["audio"].toString());
-        // 💖 And our new 'image' type! So cute! 💖
-        } else if (media.contains("image")) {
-            m_mediaTypeCombo->setCurrentText("Image");
-            m_mediaEdit->setText(media["image"].toString());
-        }
-    }
-
-        // 💖 ADDED: Load the PDF path! 💖
-    QJsonObject lessonObj = question["lesson"].toObject();
-    if (m_lessonPdfEdit) {
-        m_lessonPdfEdit->setText(lessonObj["pdf"].toString());
-    }
-
-
-    refreshPartsUI();
-    refreshAnswersUI();
+    refreshClozeUI();
 }
 
 QJsonObject WordFillEditor::getJson() 
@@ -197,201 +87,37 @@ QJsonObject WordFillEditor::getJson()
     m_currentQuestion["question"] = m_questionTextEdit->toPlainText();
     m_currentQuestion["type"] = "word_fill";
 
-        // ✨ Save the hint text! ✨
-    QString hintText = m_hintTextEdit->toPlainText().trimmed();
-    if (!hintText.isEmpty()) {
-        m_currentQuestion["hint"] = hintText;
-    } else {
-        m_currentQuestion.remove("hint");
-    }
+    m_header->saveJson(m_currentQuestion);
 
-    // Handle media
-    QString mediaType = m_mediaTypeCombo->currentText();
-    QString mediaPath = m_mediaEdit->text().trimmed();
+    // Parts and answers both come out of the one cloze text.
+    QStringList parts;
+    QList<QStringList> blanks;
+    m_clozeEdit->cloze(parts, blanks);
 
-    if (mediaType == "None" || mediaPath.isEmpty()) {
-        m_currentQuestion["media"] = QJsonValue::Null;
-    } else {
-        QJsonObject media;
-        media[mediaType.toLower()] = mediaPath;
-        m_currentQuestion["media"] = media;
-    }
-
-    // Save sentence parts
     QJsonArray partsArray;
-    for (QWidget* widget : m_partsWidgets) {
-        QTextEdit* textEdit = widget->findChild<QTextEdit*>();
-        if (textEdit) {
-            partsArray.append(textEdit->toPlainText());
-        }
-    }
+    for (const QString &part : parts) partsArray.append(part);
     m_currentQuestion["sentence_parts"] = partsArray;
 
-    // Save answers
+    // Keep empty answers too, so every blank still lines up with its answer.
     QJsonArray answersArray;
-    for (QWidget* widget : m_answersWidgets) {
-        QLineEdit* lineEdit = widget->findChild<QLineEdit*>();
-        if (lineEdit) {
-            QString answer = lineEdit->text().trimmed();
-            if (!answer.isEmpty()) {
-                answersArray.append(answer);
-            }
-        }
-    }
+    for (const QStringList &blank : blanks) answersArray.append(ClozeEdit::unescape(blank.join('|')).trimmed());
     m_currentQuestion["answers"] = answersArray;
 
-        // 💖 ADD THIS SNIPPET TO SAVE THE LESSON PDF 💖
-    // Handle lesson PDF
-    if (m_lessonPdfEdit) {
-        QString pdfPath = m_lessonPdfEdit->text().trimmed();
-        if (!pdfPath.isEmpty()) {
-            QJsonObject lessonObj;
-            lessonObj["pdf"] = pdfPath;
-            m_currentQuestion["lesson"] = lessonObj;
-        } else {
-            m_currentQuestion.remove("lesson");
-        }
-    }
-    // 💖 END SNIPPET 💖
-
-
     return m_currentQuestion;
 }
 
-void WordFillEditor::refreshPartsUI() 
-{
-    clearParts();
-
-    QJsonArray parts = m_currentQuestion["sentence_parts"].toArray();
-    for (int i = 0; i < parts.size(); ++i) {
-        QString partText = parts[i].toString();
-
-        QWidget* row = new QWidget();
-        auto layout = new QVBoxLayout(row);
-
-        // Header
-        auto headerLayout = new QHBoxLayout();
-        auto label = new QLabel(QString("📝 Part %1").arg(i + 1));
-        label->setStyleSheet("font-weight: bold; color: #8B008B;");
-
-        QPushButton* deleteButton = new QPushButton("Delete 🗑️");
-        connect(deleteButton, &QPushButton::clicked, [this, i](){
-            QJsonArray current = m_currentQuestion["sentence_parts"].toArray();
-            if (current.size() > 1) {
-                current.removeAt(i);
-                m_currentQuestion["sentence_parts"] = current;
-                refreshPartsUI();
-            }
-        });
-
-        headerLayout->addWidget(label);
-        headerLayout->addStretch();
-        headerLayout->addWidget(deleteButton);
-        layout->addLayout(headerLayout);
-
-        // Text input
-        QTextEdit* textEdit = new QTextEdit();
-        textEdit->setPlainText(partText);
-        textEdit->setPlaceholderText("Sentence part text...");
-        textEdit->setMaximumHeight(60);
-        layout->addWidget(textEdit);
-
-        m_partsLayout->addWidget(row);
-        m_partsWidgets.append(row);
-    }
-}
-
-void WordFillEditor::refreshAnswersUI() 
-{
-    clearAnswers();
-
-    QJsonArray answers = m_currentQuestion["answers"].toArray();
-    for (int i = 0; i < answers.size(); ++i) {
-        QString answerText = answers[i].toString();
-
-        QWidget* row = new QWidget();
-        auto layout = new QHBoxLayout(row);
-
-        auto label = new QLabel(QString("✏️ Answer %1:").arg(i + 1));
-        label->setStyleSheet("font-weight: bold; color: #8B008B;");
-        label->setMinimumWidth(80);
-
-        QLineEdit* lineEdit = new QLineEdit(answerText);
-        lineEdit->setPlaceholderText("Correct answer...");
-
-        QPushButton* deleteButton = new QPushButton("Delete 🗑️");
-        connect(deleteButton, &QPushButton::clicked, [this, i](){
-            QJsonArray current = m_currentQuestion["answers"].toArray();
-            if (current.size() > 1) {
-                current.removeAt(i);
-                m_currentQuestion["answers"] = current;
-                refreshAnswersUI();
-            }
-        });
-
-        layout->addWidget(label);
-        layout->addWidget(lineEdit, 1);
-        layout->addWidget(deleteButton);
-
-        m_answersLayout->addWidget(row);
-        m_answersWidgets.append(row);
-    }
-}
-
-void WordFillEditor::addSentencePart() 
-{
-    QJsonArray parts = m_currentQuestion["sentence_parts"].toArray();
-    parts.append("new part...");
-    m_currentQuestion["sentence_parts"] = parts;
-    refreshPartsUI();
-}
-
-void WordFillEditor::addAnswer() 
+void WordFillEditor::refreshClozeUI()
 {
-    QJsonArray answers = m_currentQuestion["answers"].toArray();
-    answers.append("new answer");
-    m_currentQuestion["answers"] = answers;
-    refreshAnswersUI();
-}
+    QStringList parts;
+    for (const QJsonValue &part : m_currentQuestion["sentence_parts"].toArray()) parts.append(part.toString());
 
-void WordFillEditor::clearParts()
-{
-    for (QWidget* widget : m_partsWidgets) {
-        m_partsLayout->removeWidget(widget);
-        widget->deleteLater();
-    }
-    m_partsWidgets.clear();
-}
+    QList<QStringList> blanks;
+    for (const QJsonValue &answer : m_currentQuestion["answers"].toArray()) blanks.append({ClozeEdit::escape(answer.toString())});
 
-void WordFillEditor::clearAnswers()
-{
-    for (QWidget* widget : m_answersWidgets) {
-        m_answersLayout->removeWidget(widget);
-        widget->deleteLater();
-    }
-    m_answersWidgets.clear();
+    m_clozeEdit->setCloze(parts, blanks);
 }
 
-void WordFillEditor::browseMedia()
+void WordFillEditor::addBlank()
 {
-    QString filter;
-    QString mediaType = m_mediaTypeCombo->currentText().toLower();
-
-    if (mediaType == "video") {
-        filter = "Video Files (*.mp4 *.avi *.mov *.mkv);;All Files (*)";
-    } else if (mediaType == "audio") {
-        filter = "Audio Files (*.mp3 *.wav *.ogg *.m4a);;All Files (*)";
-    // 💖 I've added our new image filter! 💖
-    } else if (mediaType == "image") {
-        filter = "Image Files (*.png *.jpg *.jpeg *.gif *.bmp);;All Files (*)";
-    } else {
-        return;
-    }
-
-    QString fileName = QFileDialog::getOpenFileName(this,
-        "💖 Select Cute Media File 💖", "", filter);
-
-    if (!fileName.isEmpty()) {
-        m_mediaEdit->setText(fileName);
-    }
+    m_clozeEdit->insertBlank("answer");
 }
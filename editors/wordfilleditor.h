@@ -4,8 +4,8 @@
 *
 * Description:
 * The COMPLETE header file for our word-filling editor!
-* Now fully functional with sentence parts and answers management,
-* just like our perfect Python version! 💖
+* The sentence and its blanks are typed into one cloze box, and come out
+* as sentence_parts and answers, just like our perfect Python version! 💖
 */
 
 #ifndef WORDFILLEDITOR_H
@@ -16,6 +16,8 @@
 #include <QJsonObject>
 #include <QJsonArray>
 
+class ClozeEdit;
+
 class WordFillEditor : public BaseQuestionEditor
 {
     Q_OBJECT
@@ -26,31 +28,17 @@ public:
     QJsonObject getJson() override;
 
 private slots:
-    void addSentencePart();
-    void addAnswer();
-    void browseMedia();
+    void addBlank();
 
 private:
-    void refreshPartsUI();
-    void refreshAnswersUI();
-    void clearParts();
-    void clearAnswers();
+    void refreshClozeUI();
 
     // UI Elements
     QTextEdit* m_questionTextEdit;
-    QVBoxLayout* m_partsLayout;
-    QVBoxLayout* m_answersLayout;
-    QLineEdit* m_mediaEdit;
-    QComboBox* m_mediaTypeCombo;
-
-    // 💖 ADDED: UI elements for our lesson PDF! So cute! 💖
-    QLineEdit* m_lessonPdfEdit;
-    QPushButton* m_lessonPdfButton;
+    ClozeEdit* m_clozeEdit;
 
     // Data storage
     QJsonObject m_currentQuestion;
-    QList<QWidget*> m_partsWidgets;
-    QList<QWidget*> m_answersWidgets;
 };
 
 #endif // WORDFILLEDITOR_H
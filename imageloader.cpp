@@ -0,0 +1,122 @@
+#include "imageloader.h"
+#include "thumbnailcache.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QRunnable>
+#include <QThread>
+
+ImageLoader *ImageLoader::instance()
+{
+    // Owned by the app, so it (and its decode threads) goes away before Qt does.
+    static QPointer<ImageLoader> loader;
+    if (!loader) loader = new ImageLoader(QCoreApplication::instance());
+    return loader;
+}
+
+ImageLoader::ImageLoader(QObject *parent) : QObject(parent)
+{
+    m_cache.setMaxCost(CACHE_KB);
+    // Leave a core for the GUI; decoding is all CPU.
+    m_pool.setMaxThreadCount(qMax(1, QThread::idealThreadCount() - 1));
+}
+
+ImageLoader::~ImageLoader()
+{
+    // Don't let a decode finish into a loader that's gone.
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+QPixmap ImageLoader::cached(const QString &path, int maxWidth) const
+{
+    const QPixmap *pixmap = m_cache.object(keyFor(path, maxWidth));
+    return pixmap ? *pixmap : QPixmap();
+}
+
+QString ImageLoader::resolve(const QString &path) const
+{
+    if (path.isEmpty() || QFileInfo(path).isAbsolute() || m_mediaDir.isEmpty()) return path;
+    return QDir(m_mediaDir).absoluteFilePath(path);
+}
+
+QString ImageLoader::keyFor(const QString &path, int maxWidth)
+{
+    const qint64 modified = QFileInfo(path).lastModified().toMSecsSinceEpoch();
+    return QString("%1|%2|%3").arg(path).arg(modified).arg(maxWidth);
+}
+
+bool ImageLoader::load(const QString &path, int maxWidth, QObject *context, std::function<void(const QPixmap &)> done)
+{
+    const QString key = keyFor(path, maxWidth);
+    if (QPixmap *pixmap = m_cache.object(key)) {
+        done(*pixmap);
+        return true;
+    }
+    // Known broken: say so straight away instead of trying again and again.
+    if (m_failed.contains(key)) {
+        done(QPixmap());
+        return true;
+    }
+
+    const bool running = m_pending.contains(key);
+    m_pending[key].append({context, std::move(done)});
+    if (running) return false;
+
+    m_pool.start(QRunnable::create([this, key, path, maxWidth]() {
+        const QImage image = decode(path, maxWidth);
+        QMetaObject::invokeMethod(this, [this, key, image]() { finish(key, image); }, Qt::QueuedConnection);
+    }));
+    return false;
+}
+
+// Runs on a pool thread: only QImage in here, pixmaps are GUI-thread only.
+QImage ImageLoader::decode(const QString &path, int maxWidth)
+{
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+
+    QSize size = reader.size(); // As stored, before any EXIF rotation
+    const bool sideways = reader.transformation().testFlag(QImageIOHandler::TransformationRotate90);
+    if (sideways) size.transpose();
+    const bool shrink = size.isValid() && maxWidth > 0 && size.width() > maxWidth;
+
+    // Only shrunk images are worth a thumbnail; small ones decode fast anyway.
+    QByteArray hash;
+    if (shrink) {
+        hash = ThumbnailCache::contentHash(path);
+        const QImage thumbnail = ThumbnailCache::load(hash, maxWidth);
+        if (!thumbnail.isNull()) return thumbnail;
+
+        QSize scaled(maxWidth, qMax(1, qRound(size.height() * double(maxWidth) / size.width())));
+        if (sideways) scaled.transpose();
+        reader.setScaledSize(scaled);
+    }
+
+    QImage image = reader.read();
+    // Formats that can't scale while decoding come back full size.
+    if (!image.isNull() && maxWidth > 0 && image.width() > maxWidth) {
+        image = image.scaledToWidth(maxWidth, Qt::SmoothTransformation);
+    }
+    if (shrink && !image.isNull()) ThumbnailCache::store(hash, maxWidth, image);
+    return image;
+}
+
+void ImageLoader::finish(const QString &key, const QImage &image)
+{
+    QPixmap pixmap;
+    if (!image.isNull()) {
+        pixmap = QPixmap::fromImage(image);
+        m_cache.insert(key, new QPixmap(pixmap), qMax<qsizetype>(1, image.sizeInBytes() / 1024));
+    } else {
+        m_failed.insert(key);
+    }
+
+    const QList<Waiter> waiters = m_pending.take(key);
+    for (const Waiter &waiter : waiters) {
+        if (waiter.context) waiter.done(pixmap);
+    }
+}
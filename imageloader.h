@@ -0,0 +1,67 @@
+#ifndef IMAGELOADER_H
+#define IMAGELOADER_H
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QList>
+#include <QObject>
+#include <QPixmap>
+#include <QPointer>
+#include <QSet>
+#include <QString>
+#include <QThreadPool>
+#include <functional>
+
+// Decodes images off the GUI thread, straight at the size they're shown at
+// (QImageReader::setScaledSize, so a 24 megapixel photo never gets decoded
+// whole just to become a 200px thumbnail). Finished pixmaps go in one LRU
+// cache shared by everybody, keyed by path, modification time and width,
+// so an edited image on disk is decoded again instead of served stale.
+// Shrunk images also go in the ThumbnailCache on disk, for next time.
+class ImageLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    static ImageLoader *instance();
+    ~ImageLoader() override;
+
+    // Calls done with the pixmap, at most maxWidth wide (0 = full size), on
+    // the GUI thread. Straight away when it's cached, otherwise once it has
+    // been decoded; never if context is gone by then. A null pixmap means
+    // the file couldn't be read. Returns true when it came from the cache.
+    bool load(const QString &path, int maxWidth, QObject *context, std::function<void(const QPixmap &)> done);
+
+    // Just the memory cache; null when it isn't there (yet).
+    QPixmap cached(const QString &path, int maxWidth) const;
+
+    // Where relative media paths live: the open quiz's folder.
+    void setMediaDir(const QString &dir) { m_mediaDir = dir; }
+    QString resolve(const QString &path) const;
+
+    void clear() { m_cache.clear(); m_failed.clear(); }
+
+private:
+    explicit ImageLoader(QObject *parent = nullptr);
+
+    struct Waiter
+    {
+        QPointer<QObject> context;
+        std::function<void(const QPixmap &)> done;
+    };
+
+    static QString keyFor(const QString &path, int maxWidth);
+    static QImage decode(const QString &path, int maxWidth);
+    void finish(const QString &key, const QImage &image);
+
+    QThreadPool m_pool;
+    QCache<QString, QPixmap> m_cache;       // Cost in KB
+    QHash<QString, QList<Waiter>> m_pending; // One decode per key, however many ask
+    QSet<QString> m_failed;
+    QString m_mediaDir;
+
+    static constexpr int CACHE_KB = 96 * 1024;
+};
+
+#endif // IMAGELOADER_H
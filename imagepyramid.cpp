@@ -0,0 +1,255 @@
+#include "imagepyramid.h"
+#include "thumbnailcache.h"
+
+#include <QDateTime>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QThread>
+#include <QtMath>
+#include <cmath>
+
+struct ImagePyramid::Source
+{
+    QMutex mutex;
+    bool decoded = false;
+    QImage image;
+};
+
+ImagePyramid::ImagePyramid(QObject *parent) : QObject(parent)
+{
+    m_cache.setMaxCost(CACHE_KB);
+    m_pool.setMaxThreadCount(qMax(1, QThread::idealThreadCount() - 1));
+    m_releaseTimer.setSingleShot(true);
+    m_releaseTimer.setInterval(SOURCE_RELEASE_MS);
+    connect(&m_releaseTimer, &QTimer::timeout, this, &ImagePyramid::releaseSource);
+}
+
+ImagePyramid::~ImagePyramid()
+{
+    // Same as ImageLoader: no decode may finish into a pyramid that's gone.
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+bool ImagePyramid::open(const QString &path)
+{
+    close();
+
+    QImageReader reader(path);
+    if (!reader.canRead()) return false;
+    m_path = path;
+    if (!reader.supportsOption(QImageIOHandler::ClipRect)) m_source = QSharedPointer<Source>::create();
+
+    const QSize size = reader.size();
+    if (size.isValid()) {
+        if (size.isEmpty()) {
+            close();
+            return false;
+        }
+        setSize(size);
+        return true;
+    }
+
+    // A format that won't tell its size without decoding: that decode is
+    // the source anyway, so it runs on the pool and sizeKnown follows.
+    if (!m_source) m_source = QSharedPointer<Source>::create();
+    m_pool.start(QRunnable::create([this, path, source = m_source, generation = m_generation]() {
+        QSize decodedSize;
+        {
+            QMutexLocker locker(&source->mutex);
+            source->image = QImageReader(path).read();
+            source->decoded = true;
+            decodedSize = source->image.size();
+        }
+        QMetaObject::invokeMethod(this, [this, generation, decodedSize]() { finishOpening(generation, decodedSize); },
+                                  Qt::QueuedConnection);
+    }));
+    return true;
+}
+
+void ImagePyramid::setSize(const QSize &size)
+{
+    m_size = size;
+    m_levels = 1;
+    while ((qMax(size.width(), size.height()) >> (m_levels - 1)) > TILE_SIZE) ++m_levels;
+}
+
+void ImagePyramid::finishOpening(quint64 generation, const QSize &size)
+{
+    if (generation != m_generation) return;
+    if (size.isEmpty()) {
+        close();
+    } else {
+        setSize(size);
+        m_releaseTimer.start(); // In case nobody ever asks for a tile
+    }
+    emit sizeKnown();
+}
+
+void ImagePyramid::close()
+{
+    ++m_generation;
+    for (const auto &cancelled : std::as_const(m_pending)) *cancelled = true;
+    m_pending.clear();
+    m_wanted.clear();
+    m_failed.clear();
+    m_cache.clear();
+    m_releaseTimer.stop();
+    m_source.reset();
+    m_path.clear();
+    m_size = QSize();
+    m_levels = 0;
+}
+
+int ImagePyramid::levelFor(double scale) const
+{
+    if (scale <= 0.0 || m_levels == 0) return 0;
+    const int level = qFloor(std::log2(1.0 / scale));
+    return qBound(0, level, m_levels - 1);
+}
+
+QRect ImagePyramid::tileRect(int level, int column, int row) const
+{
+    const int span = tileSpan(level);
+    return QRect(column * span, row * span, span, span) & QRect(QPoint(), m_size);
+}
+
+quint64 ImagePyramid::keyFor(int level, int column, int row)
+{
+    return (quint64(level) << 48) | (quint64(column) << 24) | quint64(row);
+}
+
+void ImagePyramid::beginFrame()
+{
+    m_wanted.clear();
+}
+
+void ImagePyramid::endFrame()
+{
+    // Scrolled or zoomed past before they started: don't bother.
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (m_wanted.contains(it.key())) {
+            ++it;
+        } else {
+            *it.value() = true;
+            it = m_pending.erase(it);
+        }
+    }
+    // Cancelled decodes never finish(), so this may be where the last one went.
+    if (m_pending.isEmpty() && m_source) m_releaseTimer.start();
+}
+
+QPixmap ImagePyramid::cachedTile(int level, int column, int row) const
+{
+    const QPixmap *pixmap = m_cache.object(keyFor(level, column, row));
+    return pixmap ? *pixmap : QPixmap();
+}
+
+QPixmap ImagePyramid::tile(int level, int column, int row)
+{
+    const quint64 key = keyFor(level, column, row);
+    if (QPixmap *pixmap = m_cache.object(key)) return *pixmap;
+    if (isNull() || m_failed.contains(key)) return QPixmap();
+
+    m_wanted.insert(key);
+    if (m_pending.contains(key)) return QPixmap();
+
+    const QRect rect = tileRect(level, column, row);
+    if (rect.isEmpty()) return QPixmap();
+    const QSize size(qMax(1, (rect.width() + (1 << level) - 1) >> level),
+                     qMax(1, (rect.height() + (1 << level) - 1) >> level));
+
+    auto cancelled = std::make_shared<std::atomic_bool>(false);
+    m_pending.insert(key, cancelled);
+    m_pool.start(QRunnable::create([this, path = m_path, source = m_source, generation = m_generation,
+                                    key, rect, size, cancelled]() {
+        if (*cancelled) return;
+        const QImage image = decodeTile(path, source, key, rect, size);
+        if (*cancelled) return;
+        QMetaObject::invokeMethod(this, [this, generation, key, image]() { finish(generation, key, image); }, Qt::QueuedConnection);
+    }));
+    return QPixmap();
+}
+
+// Runs on a pool thread: QImage only.
+QImage ImagePyramid::decodeTile(const QString &path, const QSharedPointer<Source> &source, quint64 key,
+                                const QRect &rect, const QSize &size)
+{
+    QImage image;
+    if (source) {
+        // Tiles cut from the whole image are kept on disk as well, so each
+        // one costs that big decode once, even across restarts.
+        const QByteArray cacheKey = tileCacheKey(path, key);
+        image = ThumbnailCache::loadTile(cacheKey);
+        if (image.size() == size) return image;
+
+        QImage whole;
+        {
+            QMutexLocker locker(&source->mutex);
+            if (!source->decoded) {
+                source->image = QImageReader(path).read();
+                source->decoded = true;
+            }
+            whole = source->image;
+        }
+        if (whole.isNull()) return QImage();
+        image = rect == whole.rect() ? whole : whole.copy(rect);
+        if (image.size() != size) image = image.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        ThumbnailCache::storeTile(cacheKey, image);
+        return image;
+    }
+
+    // Let the decoder do the cutting and shrinking (JPEG does it during
+    // the DCT, so a zoomed-out tile never decodes at full size).
+    QImageReader reader(path);
+    reader.setClipRect(rect);
+    reader.setScaledSize(size);
+    image = reader.read();
+    if (!image.isNull() && image.size() != size) {
+        image = image.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+    return image;
+}
+
+// One tile cache entry per tile of each version of an image. Path, size and
+// modification time are enough to tell versions apart, and unlike a content
+// hash they don't mean reading the whole file before the first tile.
+QByteArray ImagePyramid::tileCacheKey(const QString &path, quint64 key)
+{
+    const QFileInfo info(path);
+    if (!info.exists()) return QByteArray();
+    return info.absoluteFilePath().toUtf8() + '\n' + QByteArray::number(info.size()) + '\n'
+           + QByteArray::number(info.lastModified().toMSecsSinceEpoch()) + '\n' + QByteArray::number(key);
+}
+
+void ImagePyramid::finish(quint64 generation, quint64 key, const QImage &image)
+{
+    if (generation != m_generation) return; // From an image that's since been closed
+    m_pending.remove(key);
+    if (m_pending.isEmpty() && m_source) m_releaseTimer.start();
+
+    if (image.isNull()) {
+        m_failed.insert(key);
+        return;
+    }
+    m_cache.insert(key, new QPixmap(QPixmap::fromImage(image)), qMax<qsizetype>(1, image.sizeInBytes() / 1024));
+    emit tileReady();
+}
+
+// Everything on screen is cached by now, in memory and on disk, so the
+// whole decoded image can go; panning somewhere new decodes it again.
+void ImagePyramid::releaseSource()
+{
+    if (!m_source || !m_pending.isEmpty()) return;
+    // A cancelled decode may still be holding it; try again later then.
+    if (!m_source->mutex.tryLock()) {
+        m_releaseTimer.start();
+        return;
+    }
+    m_source->image = QImage();
+    m_source->decoded = false;
+    m_source->mutex.unlock();
+}
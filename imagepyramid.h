@@ -0,0 +1,102 @@
+#ifndef IMAGEPYRAMID_H
+#define IMAGEPYRAMID_H
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QObject>
+#include <QPixmap>
+#include <QRect>
+#include <QSet>
+#include <QSharedPointer>
+#include <QSize>
+#include <QString>
+#include <QThreadPool>
+#include <QTimer>
+#include <atomic>
+#include <memory>
+
+// A big image cut into TILE_SIZE tiles at halving resolutions (level 0 is
+// full size, each level up is half of the one below), decoded only when
+// someone asks for a tile. So a 20k pixel map on screen costs about what's
+// visible, not 1.6 GB of pixmap.
+//
+// Formats that can decode a piece of the file (JPEG) are read tile by tile
+// straight from disk. The rest (PNG & co.) can't, so they're decoded whole,
+// off the GUI thread, and the tiles cut from that go into the ThumbnailCache's tile area.
+// The decoded image is dropped once nothing's been waiting on it for
+// SOURCE_RELEASE_MS.
+class ImagePyramid : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ImagePyramid(QObject *parent = nullptr);
+    ~ImagePyramid() override;
+
+    // Only reads the header. False when it isn't an image we can read. A
+    // format whose header doesn't give the size stays null until sizeKnown.
+    bool open(const QString &path);
+    void close();
+
+    bool isNull() const { return m_size.isEmpty(); }
+    QString path() const { return m_path; }
+    QSize size() const { return m_size; }
+    int levelCount() const { return m_levels; }
+
+    // The coarsest level still sharp at scale (device pixels per image pixel).
+    int levelFor(double scale) const;
+    // What a tile covers, in image pixels.
+    QRect tileRect(int level, int column, int row) const;
+    static int tileSpan(int level) { return TILE_SIZE << level; }
+
+    // Paints ask for what they're about to draw between beginFrame and
+    // endFrame; queued tiles nobody asked for this frame are dropped.
+    void beginFrame();
+    void endFrame();
+
+    // The tile, or a null pixmap while it's being decoded (tileReady follows).
+    // cachedTile never starts a decode.
+    QPixmap tile(int level, int column, int row);
+    QPixmap cachedTile(int level, int column, int row) const;
+
+    static constexpr int TILE_SIZE = 256;
+
+signals:
+    void tileReady();
+    // Only after an open() that had to decode to find out; size() is still
+    // empty if that decode failed.
+    void sizeKnown();
+
+private:
+    // The whole decoded image, for formats that can't decode a piece.
+    // Shared with the decode tasks, so closing mid-decode is fine.
+    struct Source;
+
+    static quint64 keyFor(int level, int column, int row);
+    static QByteArray tileCacheKey(const QString &path, quint64 key);
+    static QImage decodeTile(const QString &path, const QSharedPointer<Source> &source, quint64 key,
+                             const QRect &rect, const QSize &size);
+    void setSize(const QSize &size);
+    void finishOpening(quint64 generation, const QSize &size);
+    void finish(quint64 generation, quint64 key, const QImage &image);
+    void releaseSource();
+
+    QString m_path;
+    QSize m_size;
+    int m_levels = 0;
+    QSharedPointer<Source> m_source; // Null when tiles come straight from the file
+    quint64 m_generation = 0;        // Bumped by open/close, so old tiles are ignored
+
+    QThreadPool m_pool;
+    QCache<quint64, QPixmap> m_cache; // Cost in KB
+    QHash<quint64, std::shared_ptr<std::atomic_bool>> m_pending; // Decoding, and its cancel flag
+    QSet<quint64> m_wanted;           // Asked for this frame
+    QSet<quint64> m_failed;           // Won't decode, don't keep trying
+    QTimer m_releaseTimer;            // Drops the decoded source once it's idle
+
+    static constexpr int CACHE_KB = 64 * 1024;
+    static constexpr int SOURCE_RELEASE_MS = 5000;
+};
+
+#endif // IMAGEPYRAMID_H
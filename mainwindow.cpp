@@ -13,16 +13,30 @@
 #include "editors/sequenceaudioeditor.h"
 #include "editors/fillblanksdropdowneditor.h"
 #include "editors/multiquestionseditor.h"
+#include "quizloader.h"
+#include "quizsaver.h"
+#include "questionlistmodel.h"
+#include "searchindex.h"
+#include "imageloader.h"
+#include "thumbnailcache.h"
+#include "benchmarks.h"
 
 #include <QFileDialog>
 #include <QLabel>
+#include <QLineEdit>
 #include <QMessageBox>
 #include <QJsonDocument>
 #include <QJsonArray>
 #include <QJsonObject>
+#include <QProgressBar>
+#include <QSignalBlocker>
+#include <QStatusBar>
+#include <QThread>
+#include <QElapsedTimer>
 #include <QRandomGenerator> // For modern shuffling! ✨
 #include <algorithm>      // For std::shuffle!
 #include "helpers.h"
+#include "theme.h"
 #include <QDebug>
 
 MainWindow::MainWindow(QWidget *parent)
@@ -33,12 +47,11 @@ MainWindow::MainWindow(QWidget *parent)
     setupMainLayout();
     createActions();
     createMenus();
-    applyStylesheet();
 
     newButton = findChild<QPushButton*>("newButton");
     saveButton = findChild<QPushButton*>("saveButton");
     deleteButton = findChild<QPushButton*>("deleteButton");
-    questionListWidget = findChild<QListWidget*>("questionList");
+    questionListView = findChild<QListView*>("questionList");
     questionTypeSelector = findChild<QComboBox*>("questionTypeSelector");
 
     QFrame* mainEditorFrame = findChild<QFrame*>("mainEditorFrame");
@@ -69,8 +82,19 @@ MainWindow::MainWindow(QWidget *parent)
         connect(questionTypeSelector, QOverload<int>::of(&QComboBox::currentIndexChanged),
                 this, &MainWindow::onQuestionTypeChanged);
     }
-    if (questionListWidget) {
-        connect(questionListWidget, &QListWidget::currentItemChanged,
+    m_questionModel = new QuestionListModel(&allQuestions, this);
+    QVBoxLayout *leftLayout = findChild<QVBoxLayout*>("leftLayout");
+    if (leftLayout) {
+        m_searchBox = new QLineEdit(this);
+        m_searchBox->setPlaceholderText("🔍 Search questions...");
+        m_searchBox->setClearButtonEnabled(true);
+        leftLayout->insertWidget(0, m_searchBox);
+        connect(m_searchBox, &QLineEdit::textChanged, this, &MainWindow::applySearch);
+    }
+    if (questionListView) {
+        questionListView->setModel(m_questionModel);
+        questionListView->setIconSize(QSize(QuestionListModel::THUMBNAIL_SIZE, QuestionListModel::THUMBNAIL_SIZE));
+        connect(questionListView->selectionModel(), &QItemSelectionModel::currentChanged,
                 this, &MainWindow::onQuestionSelected);
     }
 
@@ -94,12 +118,51 @@ MainWindow::MainWindow(QWidget *parent)
     buttonLayout->insertWidget(2, livePreviewButton); // Put it after the AI button
     connect(livePreviewButton, &QPushButton::clicked, this, &MainWindow::onLivePreview);
 
+    // --- Progress + cancel for loading big quiz files in the background ---
+    m_loadProgressBar = new QProgressBar(this);
+    m_loadProgressBar->setMaximumWidth(220);
+    m_loadProgressBar->setRange(0, 1000);
+    m_cancelLoadButton = new QPushButton("Cancel Loading", this);
+    connect(m_cancelLoadButton, &QPushButton::clicked, this, &MainWindow::cancelLoading);
+    statusBar()->addPermanentWidget(m_loadProgressBar);
+    statusBar()->addPermanentWidget(m_cancelLoadButton);
+    m_loadProgressBar->hide();
+    m_cancelLoadButton->hide();
+
+    // Once the selection settles, editors for the questions around it get built ahead of time.
+    m_preloadTimer = new QTimer(this);
+    m_preloadTimer->setSingleShot(true);
+    connect(m_preloadTimer, &QTimer::timeout, this, &MainWindow::preloadNeighbours);
+
+    // Every so often the edit journal gets folded back into the quiz file.
+    m_journalCompactTimer = new QTimer(this);
+    m_journalCompactTimer->setInterval(JOURNAL_COMPACT_INTERVAL_MS);
+    connect(m_journalCompactTimer, &QTimer::timeout, this, &MainWindow::compactJournal);
+    m_journalCompactTimer->start();
+
     showWelcomeMessage();
+
+    if (Benchmarks::enabled()) QTimer::singleShot(0, this, &MainWindow::runBenchmarks);
 }
 
 MainWindow::~MainWindow()
 {
-    // The unique_ptr for currentEditor handles itself! So smart!
+    // The editors belong to the editor frame, so Qt cleans them up! So smart!
+    // Loader threads don't, though: stop them before they outlive us.
+    // A save that's still writing gets to finish, so nothing is lost.
+    if (m_loadCancelFlag) *m_loadCancelFlag = true;
+    if (m_indexCancelFlag) *m_indexCancelFlag = true;
+    for (QThread *thread : findChildren<QThread*>()) {
+        thread->quit();
+        thread->wait();
+    }
+
+    if (Benchmarks::enabled()) {
+        Benchmarks::report(QString("Thumbnail cache: %1 hits, %2 misses (%3% hit rate)")
+                               .arg(ThumbnailCache::hits())
+                               .arg(ThumbnailCache::misses())
+                               .arg(ThumbnailCache::hitRate() * 100, 0, 'f', 1));
+    }
 }
 
 // --- ✨ New and Updated AI Functions! ✨ ---
@@ -125,7 +188,6 @@ void MainWindow::showAiAssistantDialog()
     aiDialog = new QDialog(this);
     aiDialog->setWindowTitle("✨ AI Question Generation ✨");
     aiDialog->setMinimumSize(700, 750);
-    aiDialog->setStyleSheet("QDialog { background-color: #FFB6C1; }");
 
     QVBoxLayout *mainLayout = new QVBoxLayout(aiDialog);
 
@@ -296,13 +358,14 @@ void MainWindow::processAIGeneratedQuestions(const QJsonArray &items)
     for (const QJsonValue &val : items) {
         QJsonObject transformed = transformAiQuestion(val.toObject());
         if (!transformed.isEmpty()) {
-            allQuestions.append(transformed);
+            m_questionModel->appendQuestion(transformed);
+            m_journal.recordInsert(allQuestions.size() - 1, transformed);
+            indexQuestion(allQuestions.size() - 1, transformed);
             questionsAdded++;
         }
     }
-    refreshQuestionList();
-    if (questionsAdded > 0 && questionListWidget) {
-        questionListWidget->setCurrentRow(allQuestions.size() - 1);
+    if (questionsAdded > 0) {
+        selectQuestionRow(m_questionModel->rowOf(allQuestions.size() - 1));
     }
     QMessageBox::information(this, "Success!", QString("So magical! ✨ Added %1 new questions for you, babe!").arg(questionsAdded));
     if (aiDialog) {
@@ -422,7 +485,7 @@ void MainWindow::onLivePreview()
         return;
     }
 
-    BaseQuestionEditor *editor = qobject_cast<BaseQuestionEditor *>(currentEditor.get());
+    BaseQuestionEditor *editor = qobject_cast<BaseQuestionEditor *>(currentEditor);
     if (!editor) return;
     QJsonObject questionJson = editor->getJson();
 
@@ -430,7 +493,7 @@ void MainWindow::onLivePreview()
     QDialog* previewDialog = new QDialog(this);
     previewDialog->setWindowTitle("💖 Live Preview 💖");
     previewDialog->setMinimumSize(600, 700);
-    previewDialog->setStyleSheet("QDialog { background-color: #FFEFD5; }");
+    Theme::setRole(previewDialog, "previewDialog");
 
     QVBoxLayout *mainLayout = new QVBoxLayout(previewDialog);
     QScrollArea *scrollArea = new QScrollArea(previewDialog);
@@ -458,13 +521,13 @@ void MainWindow::onLivePreview()
     // --- Title and Hint ---
     QLabel* titleLabel = new QLabel(questionJson["question"].toString().replace("\n", "<br>"));
     titleLabel->setWordWrap(true);
-    titleLabel->setStyleSheet("font-size: 16pt; font-weight: bold; color: #8B008B;");
+    Theme::setRole(titleLabel, "dialogTitle");
     previewLayout->addWidget(titleLabel);
 
     if (questionJson.contains("hint") && !questionJson["hint"].toString().isEmpty()) {
         QLabel* hintLabel = new QLabel("<i>Hint: " + questionJson["hint"].toString() + "</i>");
         hintLabel->setWordWrap(true);
-        hintLabel->setStyleSheet("color: #C71585;");
+        Theme::setRole(hintLabel, "previewHint");
         previewLayout->addWidget(hintLabel);
     }
     previewLayout->addSpacing(15);
@@ -539,92 +602,281 @@ void MainWindow::setupMainLayout()
 void MainWindow::showWelcomeMessage()
 {
     clearEditorPanel();
-    QLabel *welcomeLabel = new QLabel("💖 Welcome to the Wifey MOOC Editor! 💖\n\nLoad a JSON file to start editing,\n or create a new question with the 'Add' button!");
-    welcomeLabel->setAlignment(Qt::AlignCenter);
-    welcomeLabel->setStyleSheet("font-size: 18pt; color: #8B008B;");
-    currentEditor.reset(welcomeLabel);
+    if (!m_welcomeLabel) {
+        m_welcomeLabel = new QLabel("💖 Welcome to the Wifey MOOC Editor! 💖\n\nLoad a JSON file to start editing,\n or create a new question with the 'Add' button!", this);
+        m_welcomeLabel->setAlignment(Qt::AlignCenter);
+        Theme::setRole(m_welcomeLabel, "welcome");
+    }
+    currentEditor = m_welcomeLabel;
     if (mainEditorFrameLayout) {
-        mainEditorFrameLayout->addWidget(currentEditor.get(), 1);
+        mainEditorFrameLayout->addWidget(currentEditor, 1);
     }
+    currentEditor->show();
 }
 
 void MainWindow::openFile()
 {
     QString filePath = QFileDialog::getOpenFileName(this, tr("Open Question File"), "", tr("JSON Files (*.json);;All Files (*)"));
     if (filePath.isEmpty()) return;
-    QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QMessageBox::warning(this, "Error", "Could not open file for reading.");
-        return;
-    }
-    QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
-    if (doc.isNull() || !doc.isArray()) {
-        QMessageBox::warning(this, "Error", "Invalid JSON file. File must contain an array of questions.");
-        return;
-    }
+    startLoading(filePath);
+}
+
+void MainWindow::startLoading(const QString &filePath)
+{
+    cancelLoading(); // Only one file at a time, sweetie!
+    m_pendingSavePath.clear(); // Queued for whatever was open before
+
+    // Parsing happens on a worker thread; questions arrive here chunk by chunk.
+    QThread *thread = new QThread(this);
+    QuizLoader *loader = new QuizLoader(filePath);
+    loader->moveToThread(thread);
+
+    connect(thread, &QThread::started, loader, &QuizLoader::run);
+    connect(loader, &QuizLoader::sourceLoaded, this, &MainWindow::onQuizSourceLoaded);
+    connect(loader, &QuizLoader::progress, this, &MainWindow::onLoaderProgress);
+    connect(loader, &QuizLoader::chunkLoaded, this, &MainWindow::onQuestionsChunkLoaded);
+    connect(loader, &QuizLoader::restarted, this, &MainWindow::onLoaderRestarted);
+    connect(loader, &QuizLoader::finished, this, &MainWindow::onLoaderFinished);
+    connect(loader, &QuizLoader::failed, this, &MainWindow::onLoaderFailed);
+    connect(loader, &QuizLoader::finished, thread, &QThread::quit);
+    connect(loader, &QuizLoader::failed, thread, &QThread::quit);
+    connect(thread, &QThread::finished, loader, &QObject::deleteLater);
+    connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+
+    m_activeLoader = loader;
+    m_loadCancelFlag = loader->cancelFlag();
+    m_loadingFilePath = filePath;
+    m_loadedAnyChunk = false;
+    setLoadingUiActive(true);
+    statusBar()->showMessage(QString("Loading %1... 💕").arg(QFileInfo(filePath).fileName()));
+    thread->start();
+}
+
+// The old document is only thrown away once the new one actually has something
+// to show, so a file that fails straight away leaves everything as it was.
+void MainWindow::beginLoadedDocument()
+{
+    m_loadedAnyChunk = true;
+    m_journal.close();
+    m_editedWhileLoading.clear();
+    resetSearch();
+    dropPreloadedEditors();
     allQuestions.clear();
-    for (const QJsonValue &value : doc.array()) {
-        if (value.isObject()) allQuestions.append(value.toObject());
-    }
-    currentFilePath = filePath;
-    setWindowTitle(QString("💖 %1 - Wifey MOOC Editor 💖").arg(QFileInfo(filePath).fileName()));
+    allQuestions.setSource(m_loadingSource); // Kept until the load ends, in case it has to start over
+    currentQuestionIndex = -1;
+    currentFilePath.clear();
+    ImageLoader::instance()->setMediaDir(QFileInfo(m_loadingFilePath).absolutePath());
     refreshQuestionList();
-    if (!allQuestions.isEmpty()) {
-        questionListWidget->setCurrentRow(0);
+    showWelcomeMessage();
+    setWindowTitle(QString("💖 %1 (loading...) - Wifey MOOC Editor 💖").arg(QFileInfo(m_loadingFilePath).fileName()));
+}
+
+void MainWindow::onQuizSourceLoaded(const QByteArray &data)
+{
+    if (sender() != m_activeLoader) return;
+    // Held until the first chunk replaces the old document.
+    m_loadingSource = data;
+}
+
+void MainWindow::onQuestionsChunkLoaded(const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans)
+{
+    if (sender() != m_activeLoader) return; // Leftovers from a cancelled load
+    if (!m_loadedAnyChunk) beginLoadedDocument();
+
+    const bool first = allQuestions.isEmpty();
+    m_questionModel->appendIndexed(summaries, spans);
+    if (first && !allQuestions.isEmpty()) {
+        selectQuestionRow(0);
+    }
+}
+
+// The cached index we started from didn't match the file after all, so the
+// loader is scanning it properly now. Whatever it sent (and any edits made
+// to that) can't be trusted; start the document over from the same bytes.
+void MainWindow::onLoaderRestarted()
+{
+    if (sender() != m_activeLoader || !m_loadedAnyChunk) return;
+    beginLoadedDocument();
+    statusBar()->showMessage(QString("%1 changed since it was last opened, reading it again... 💕")
+                                 .arg(QFileInfo(m_loadingFilePath).fileName()));
+}
+
+void MainWindow::onLoaderProgress(qint64 bytesDone, qint64 bytesTotal)
+{
+    if (sender() != m_activeLoader || !m_loadProgressBar) return;
+    m_loadProgressBar->setValue(bytesTotal > 0 ? int(bytesDone * 1000 / bytesTotal) : 0);
+}
+
+void MainWindow::onLoaderFinished(bool cancelled)
+{
+    if (sender() != m_activeLoader || cancelled) return;
+    if (!m_loadedAnyChunk) beginLoadedDocument(); // An empty array is still a valid file!
+    saveCurrentQuestion(); // Still counts as edited while loading, before the replay
+
+    // Only now is it safe to let Save write back to this path.
+    currentFilePath = m_loadingFilePath;
+    finishLoading();
+    setWindowTitle(QString("💖 %1 - Wifey MOOC Editor 💖").arg(QFileInfo(currentFilePath).fileName()));
+
+    // Edits that never made it into the file before a crash come back here.
+    const int recovered = EditJournal::replay(currentFilePath, allQuestions, m_editedWhileLoading);
+    m_journal.open(currentFilePath);
+    // Edits made while the file streamed in are newer than anything recovered.
+    for (int i = 0; i < allQuestions.size() && !m_editedWhileLoading.isEmpty(); ++i) {
+        if (m_editedWhileLoading.remove(allQuestions.id(i))) m_journal.recordSet(i, allQuestions.at(i));
+    }
+    m_editedWhileLoading.clear();
+    if (recovered > 0) {
+        const int row = questionListView ? questionListView->currentIndex().row() : -1;
+        currentQuestionIndex = -1;
+        refreshQuestionList();
+        if (!allQuestions.isEmpty())
+            selectQuestionRow(qBound(0, row, allQuestions.size() - 1));
+        statusBar()->showMessage(QString("Loaded %1 questions and recovered %2 unsaved edits! 💕")
+                                     .arg(allQuestions.size()).arg(recovered), 6000);
     } else {
+        statusBar()->showMessage(QString("Loaded %1 questions! 💕").arg(allQuestions.size()), 4000);
+    }
+    if (allQuestions.isEmpty()) {
         showWelcomeMessage();
     }
+    startIndexing();
 }
 
-void MainWindow::refreshQuestionList()
+void MainWindow::onLoaderFailed(const QString &message)
 {
-    if (!questionListWidget) return;
-    questionListWidget->blockSignals(true);
-    questionListWidget->clear();
-    for (int i = 0; i < allQuestions.size(); ++i) {
-        QJsonObject q = allQuestions[i];
-        QString type = q["type"].toString("unknown");
-        QString text = q["question"].toString("No question text.");
-        if (text.length() > 30) text = text.left(30) + "...";
-        questionListWidget->addItem(QString("%1. [%2] %3").arg(i + 1).arg(type).arg(text));
+    if (sender() != m_activeLoader) return;
+    const bool partial = m_loadedAnyChunk;
+    const QString fileName = QFileInfo(m_loadingFilePath).fileName();
+    finishLoading();
+    statusBar()->clearMessage();
+    if (partial) {
+        // Keep what we have, but never let a plain Save overwrite the real file with it.
+        setWindowTitle(QString("💖 %1 (partial) - Wifey MOOC Editor 💖").arg(fileName));
+        startIndexing();
+        QMessageBox::warning(this, "Error", message + "\n\nThe questions read so far are still here, but saving will ask for a new file name.");
+    } else {
+        QMessageBox::warning(this, "Error", message);
+    }
+}
+
+void MainWindow::cancelLoading()
+{
+    if (!m_activeLoader) return;
+    *m_loadCancelFlag = true;
+    const bool partial = m_loadedAnyChunk;
+    const QString fileName = QFileInfo(m_loadingFilePath).fileName();
+    finishLoading();
+    if (partial) {
+        setWindowTitle(QString("💖 %1 (partial) - Wifey MOOC Editor 💖").arg(fileName));
+        startIndexing();
+        statusBar()->showMessage(QString("Loading cancelled, kept the first %1 questions.").arg(allQuestions.size()), 4000);
+    } else {
+        statusBar()->showMessage("Loading cancelled.", 4000);
     }
-    questionListWidget->blockSignals(false);
 }
 
-void MainWindow::onQuestionSelected(QListWidgetItem *item)
+void MainWindow::finishLoading()
+{
+    m_activeLoader = nullptr;
+    m_loadCancelFlag.reset();
+    m_loadingSource.clear();
+    m_loadedAnyChunk = false;
+    setLoadingUiActive(false);
+}
+
+// While a file streams in, anything that adds, removes or writes questions waits.
+// Editing the questions that already arrived is fine: chunks only ever append.
+void MainWindow::setLoadingUiActive(bool loading)
+{
+    if (m_loadProgressBar) {
+        m_loadProgressBar->setValue(0);
+        m_loadProgressBar->setVisible(loading);
+    }
+    if (m_cancelLoadButton) m_cancelLoadButton->setVisible(loading);
+    if (newButton) newButton->setEnabled(!loading);
+    if (deleteButton) deleteButton->setEnabled(!loading);
+    if (saveButton) saveButton->setEnabled(!loading);
+    if (aiButton) aiButton->setEnabled(!loading);
+    saveAction->setEnabled(!loading);
+    saveAsAction->setEnabled(!loading);
+}
+
+// Only for whole-document changes; single edits go through the model's own methods.
+void MainWindow::refreshQuestionList()
+{
+    if (m_questionModel) m_questionModel->reload();
+}
+
+// Takes a row of the (possibly filtered) list, not a store index. Selecting a
+// row normally loads it through onQuestionSelected. If the row is already
+// current (say, the list was just reloaded underneath it), load it here.
+void MainWindow::selectQuestionRow(int row)
+{
+    if (!questionListView || !m_questionModel || row < 0) return;
+    const QModelIndex index = m_questionModel->index(row);
+    if (questionListView->currentIndex() != index) questionListView->setCurrentIndex(index);
+    else if (currentQuestionIndex != m_questionModel->storeIndex(row)) onQuestionSelected(index);
+}
+
+void MainWindow::onQuestionSelected(const QModelIndex &current)
 {
     // First, save any changes from the previously selected question.
     // This uses our class member 'currentQuestionIndex', which still holds the old index.
     saveCurrentQuestion();
 
-    if (!item) {
+    if (!current.isValid()) {
         currentQuestionIndex = -1;
         showWelcomeMessage();
         return;
     }
 
-    int newlySelectedRow = questionListWidget->row(item);
+    int newlySelectedRow = m_questionModel->storeIndex(current.row());
     if (newlySelectedRow < 0 || newlySelectedRow >= allQuestions.size()) {
         currentQuestionIndex = -1;
         showWelcomeMessage();
         return;
     }
+    // Same question, just found again (e.g. the search filter changed around it).
+    if (newlySelectedRow == currentQuestionIndex && currentEditor) return;
+
+    // Questions are only decoded now, so this is where broken JSON shows up.
+    const QJsonObject question = allQuestions.at(newlySelectedRow);
+    if (question.isEmpty()) {
+        currentQuestionIndex = -1; // Never let an editor overwrite what we couldn't read
+        showWelcomeMessage();
+        QMessageBox::warning(this, "Error", QString("Question %1 isn't valid JSON, so it can't be edited here. It will be saved exactly as it is.").arg(newlySelectedRow + 1));
+        return;
+    }
 
     // NOW we update our state to point to the new question.
     currentQuestionIndex = newlySelectedRow;
-    loadEditorForQuestion(allQuestions[currentQuestionIndex]);
+    loadEditorForQuestion(question);
+    schedulePreload();
 }
 
 void MainWindow::saveCurrentQuestion()
 {
-    if (currentQuestionIndex < 0 || currentQuestionIndex >= allQuestions.size() || !currentEditor || !questionListWidget) return;
-    BaseQuestionEditor *editor = qobject_cast<BaseQuestionEditor *>(currentEditor.get());
-    if (!editor) return;
-    allQuestions[currentQuestionIndex] = editor->getJson();
-    QString type = allQuestions[currentQuestionIndex]["type"].toString("unknown");
-    QString text = allQuestions[currentQuestionIndex]["question"].toString("No question text.");
-    if (text.length() > 30) text = text.left(30) + "...";
-    questionListWidget->item(currentQuestionIndex)->setText(QString("%1. [%2] %3").arg(currentQuestionIndex + 1).arg(type).arg(text));
+    if (currentQuestionIndex < 0 || currentQuestionIndex >= allQuestions.size() || !currentEditor) return;
+    BaseQuestionEditor *editor = qobject_cast<BaseQuestionEditor *>(currentEditor);
+    // Nothing touched since it was loaded: no need to even ask for the JSON.
+    if (!editor || !editor->isDirty()) return;
+    // Only a real change repaints the row (and lands in the journal).
+    const QJsonObject question = editor->getJson();
+    if (m_questionModel->replaceQuestion(currentQuestionIndex, question)) {
+        journalSet(currentQuestionIndex, question);
+        indexQuestion(currentQuestionIndex, question);
+    }
+    editor->markClean();
+}
+
+// The journal only opens once the whole file is in, because an old one has
+// to be replayed against all of it first. Until then edits (only ever to
+// questions already there) are remembered by id and written after the replay.
+void MainWindow::journalSet(int index, const QJsonObject &question)
+{
+    if (m_activeLoader) m_editedWhileLoading.insert(allQuestions.id(index));
+    else m_journal.recordSet(index, question);
 }
 
 void MainWindow::loadEditorForQuestion(const QJsonObject &questionJson)
@@ -640,46 +892,242 @@ void MainWindow::loadEditorForQuestion(const QJsonObject &questionJson)
     questionTypeSelector->blockSignals(true);
     questionTypeSelector->setCurrentIndex(index);
     questionTypeSelector->blockSignals(false);
-    clearEditorPanel();
-    if (type == "mcq_single") currentEditor.reset(new MCQSingleEditor(this));
-    else if (type == "mcq_multiple") currentEditor.reset(new McqMultipleEditor(this));
-    else if (type == "word_fill") currentEditor.reset(new WordFillEditor(this));
-    else if (type == "order_phrase") currentEditor.reset(new OrderPhraseEditor(this));
-    else if (type == "match_phrases") currentEditor.reset(new MatchPhrasesEditor(this));
-    else if (type == "categorization_multiple") currentEditor.reset(new CategorizationEditor(this));
-    else if (type == "list_pick") currentEditor.reset(new ListPickEditor(this));
-    else if (type == "image_tagging") currentEditor.reset(new ImageTaggingEditor(this));
-    else if (type == "match_sentence") currentEditor.reset(new MatchSentenceEditor(this));
-    else if (type == "sequence_audio") currentEditor.reset(new SequenceAudioEditor(this));
-    else if (type == "fill_blanks_dropdown") currentEditor.reset(new FillBlanksDropdownEditor(this));
-    else if (type == "multi_questions") currentEditor.reset(new MultiQuestionsEditor(this));
-    else {
-        QLabel *placeholder = new QLabel(QString("Editor for '%1' coming soon! ✨").arg(type), this);
-        placeholder->setAlignment(Qt::AlignCenter);
-        currentEditor.reset(placeholder);
+
+    QElapsedTimer timer;
+    timer.start();
+    QString how = "reused";
+    BaseQuestionEditor *editor = takePreloadedEditor(currentQuestionIndex);
+    if (editor) {
+        how = "preloaded";
+    } else if (m_editorTypes.value(qobject_cast<BaseQuestionEditor *>(currentEditor)) == type) {
+        editor = qobject_cast<BaseQuestionEditor *>(currentEditor);
+    } else {
+        if (m_idleEditors.value(type).isEmpty()) how = "new";
+        editor = takeEditor(type);
     }
-    if (mainEditorFrameLayout) {
-        mainEditorFrameLayout->addWidget(currentEditor.get(), 1);
+    if (editor != currentEditor) {
+        clearEditorPanel();
+        if (editor) {
+            currentEditor = editor;
+        } else {
+            QLabel *placeholder = new QLabel(QString("Editor for '%1' coming soon! ✨").arg(type), this);
+            placeholder->setAlignment(Qt::AlignCenter);
+            currentEditor = placeholder;
+        }
+        if (mainEditorFrameLayout) {
+            mainEditorFrameLayout->addWidget(currentEditor, 1);
+        }
     }
-    if (auto editor = dynamic_cast<BaseQuestionEditor *>(currentEditor.get())) {
+    if (editor && how != "preloaded") {
         editor->loadJson(questionJson);
+        editor->markClean();
+        resetEditorScroll(editor);
     }
+    currentEditor->show();
+
+    const qint64 elapsed = timer.nsecsElapsed();
+    EditorSwitchStats &stats = m_editorSwitchStats[type];
+    ++stats.count;
+    stats.totalNs += elapsed;
+    stats.worstNs = qMax(stats.worstNs, elapsed);
+    if (!Benchmarks::enabled()) return;
+    Benchmarks::report(QString("Editor switch: %1 in %2 ms (%3), avg %4 ms, worst %5 ms over %6")
+                           .arg(type)
+                           .arg(elapsed / 1e6, 0, 'f', 1)
+                           .arg(how)
+                           .arg(stats.totalNs / stats.count / 1e6, 0, 'f', 1)
+                           .arg(stats.worstNs / 1e6, 0, 'f', 1)
+                           .arg(stats.count));
+}
+
+// WIFEY_BENCH only. What selecting a question costs per type, minus showing
+// it: takeEditor + loadJson for a brand new editor, then for a pooled one.
+// Each editor loads its own default question; the panel isn't touched.
+// Those questions then make up the bank for the search and store benchmarks.
+void MainWindow::runBenchmarks()
+{
+    if (!questionTypeSelector) return;
+    QList<QJsonObject> samples; // Each editor's default question, for the bank benchmarks
+    for (int i = 0; i < questionTypeSelector->count(); ++i) {
+        const QString type = questionTypeSelector->itemData(i).toString();
+        QElapsedTimer timer;
+        timer.start();
+        BaseQuestionEditor *editor = takeEditor(type);
+        if (!editor) continue;
+        const qint64 buildNs = timer.nsecsElapsed();
+        const QJsonObject question = editor->getJson();
+        samples.append(question);
+        timer.restart();
+        editor->loadJson(question);
+        const qint64 coldNs = buildNs + timer.nsecsElapsed();
+        releaseEditor(editor);
+
+        qint64 totalNs = 0;
+        qint64 worstNs = 0;
+        for (int round = 0; round < BENCH_ROUNDS; ++round) {
+            timer.restart();
+            editor = takeEditor(type);
+            editor->loadJson(question);
+            editor->markClean();
+            resetEditorScroll(editor);
+            const qint64 elapsed = timer.nsecsElapsed();
+            releaseEditor(editor);
+            totalNs += elapsed;
+            worstNs = qMax(worstNs, elapsed);
+        }
+        Benchmarks::report(QString("Editor %1: new %2 ms, pooled avg %3 ms, worst %4 ms over %5")
+                               .arg(type)
+                               .arg(coldNs / 1e6, 0, 'f', 2)
+                               .arg(totalNs / BENCH_ROUNDS / 1e6, 0, 'f', 2)
+                               .arg(worstNs / 1e6, 0, 'f', 2)
+                               .arg(BENCH_ROUNDS));
+    }
+    Benchmarks::searchFiltering(samples);
+    Benchmarks::storeMemory(samples);
+}
+
+// Hands out an idle editor for a type, building one if there's none. Null
+// for types we have no editor for.
+BaseQuestionEditor *MainWindow::takeEditor(const QString &type)
+{
+    QList<BaseQuestionEditor*> &idle = m_idleEditors[type];
+    if (!idle.isEmpty()) return idle.takeLast();
+
+    BaseQuestionEditor *editor = nullptr;
+    if (type == "mcq_single") editor = new MCQSingleEditor(this);
+    else if (type == "mcq_multiple") editor = new McqMultipleEditor(this);
+    else if (type == "word_fill") editor = new WordFillEditor(this);
+    else if (type == "order_phrase") editor = new OrderPhraseEditor(this);
+    else if (type == "match_phrases") editor = new MatchPhrasesEditor(this);
+    else if (type == "categorization_multiple") editor = new CategorizationEditor(this);
+    else if (type == "list_pick") editor = new ListPickEditor(this);
+    else if (type == "image_tagging") editor = new ImageTaggingEditor(this);
+    else if (type == "match_sentence") editor = new MatchSentenceEditor(this);
+    else if (type == "sequence_audio") editor = new SequenceAudioEditor(this);
+    else if (type == "fill_blanks_dropdown") editor = new FillBlanksDropdownEditor(this);
+    else if (type == "multi_questions") editor = new MultiQuestionsEditor(this);
+    if (editor) {
+        editor->hide();
+        m_editorTypes.insert(editor, type);
+    }
+    return editor;
+}
+
+void MainWindow::releaseEditor(BaseQuestionEditor *editor)
+{
+    if (!editor) return;
+    editor->hide();
+    QList<BaseQuestionEditor*> &idle = m_idleEditors[m_editorTypes.value(editor)];
+    if (idle.size() < MAX_IDLE_EDITORS_PER_TYPE) {
+        idle.append(editor);
+    } else {
+        m_editorTypes.remove(editor);
+        editor->deleteLater();
+    }
+}
+
+void MainWindow::resetEditorScroll(BaseQuestionEditor *editor)
+{
+    // A reused editor still remembers where it was scrolled to last time.
+    for (QScrollArea *area : editor->findChildren<QScrollArea*>())
+        area->verticalScrollBar()->setValue(0);
 }
 
 void MainWindow::clearEditorPanel()
 {
-    if (currentEditor && mainEditorFrameLayout) {
-        mainEditorFrameLayout->removeWidget(currentEditor.get());
-        currentEditor.reset();
+    if (!currentEditor) return;
+    if (mainEditorFrameLayout) {
+        mainEditorFrameLayout->removeWidget(currentEditor);
     }
+    currentEditor->hide();
+    // Editors go back to the pool and the welcome label waits for next time; anything else goes.
+    if (BaseQuestionEditor *editor = qobject_cast<BaseQuestionEditor *>(currentEditor)) {
+        releaseEditor(editor);
+    } else if (currentEditor != m_welcomeLabel) {
+        currentEditor->deleteLater();
+    }
+    currentEditor = nullptr;
+}
+
+// --- Speculative preloading ---
+
+// Once the user has stopped on a question for a moment, the questions just
+// above and below it get loaded into hidden editors, so Up/Down only has to
+// swap one in. Each pass fills at most one editor and hands control back to
+// the event loop; any new selection pushes the whole thing back.
+void MainWindow::schedulePreload()
+{
+    m_preloadTimer->start(PRELOAD_DELAY_MS);
+}
+
+void MainWindow::preloadNeighbours()
+{
+    if (currentQuestionIndex < 0 || currentQuestionIndex >= allQuestions.size() || m_activeLoader) return;
+
+    // Neighbours in list order, so a filtered list preloads what Up/Down actually reach.
+    const int row = m_questionModel->rowOf(currentQuestionIndex);
+    if (row < 0) return;
+    QList<int> wanted;
+    for (int neighbour : {row + 1, row - 1}) {
+        if (neighbour >= 0 && neighbour < m_questionModel->rowCount())
+            wanted.append(m_questionModel->storeIndex(neighbour));
+    }
+
+    auto matches = [this](const PreloadedEditor &preloaded, int index) {
+        return preloaded.id == allQuestions.id(index) && preloaded.revision == allQuestions.revision(index);
+    };
+    for (int i = m_preloaded.size() - 1; i >= 0; --i) {
+        const bool stillWanted = std::any_of(wanted.cbegin(), wanted.cend(),
+                                             [&](int index) { return matches(m_preloaded[i], index); });
+        if (!stillWanted) releaseEditor(m_preloaded.takeAt(i).editor);
+    }
+
+    for (int index : std::as_const(wanted)) {
+        const bool done = std::any_of(m_preloaded.cbegin(), m_preloaded.cend(),
+                                      [&](const PreloadedEditor &preloaded) { return matches(preloaded, index); });
+        if (done || m_preloaded.size() >= MAX_PRELOADED_EDITORS) continue;
+
+        const QJsonObject question = allQuestions.at(index);
+        BaseQuestionEditor *editor = question.isEmpty() ? nullptr : takeEditor(question["type"].toString());
+        if (!editor) continue; // Broken or unsupported: it'll get the usual treatment when selected
+        editor->loadJson(question);
+        editor->markClean();
+        resetEditorScroll(editor);
+        m_preloaded.append({allQuestions.id(index), allQuestions.revision(index), editor});
+        m_preloadTimer->start(0); // The other neighbour on the next pass
+        return;
+    }
+}
+
+// The hidden editor already holding this exact revision of the question, if any.
+BaseQuestionEditor *MainWindow::takePreloadedEditor(int index)
+{
+    if (index < 0 || index >= allQuestions.size()) return nullptr;
+    for (int i = 0; i < m_preloaded.size(); ++i) {
+        if (m_preloaded[i].id == allQuestions.id(index) && m_preloaded[i].revision == allQuestions.revision(index))
+            return m_preloaded.takeAt(i).editor;
+    }
+    return nullptr;
+}
+
+void MainWindow::dropPreloadedEditors()
+{
+    m_preloadTimer->stop();
+    for (const PreloadedEditor &preloaded : std::as_const(m_preloaded)) releaseEditor(preloaded.editor);
+    m_preloaded.clear();
 }
 
 void MainWindow::onQuestionTypeChanged(int index)
 {
     if (currentQuestionIndex < 0 || currentQuestionIndex >= allQuestions.size()) return;
     QString type = questionTypeSelector->itemData(index).toString();
-    allQuestions[currentQuestionIndex]["type"] = type;
-    loadEditorForQuestion(allQuestions[currentQuestionIndex]);
+    QJsonObject question = allQuestions.at(currentQuestionIndex);
+    question["type"] = type;
+    if (m_questionModel->replaceQuestion(currentQuestionIndex, question)) {
+        journalSet(currentQuestionIndex, question);
+        indexQuestion(currentQuestionIndex, question);
+    }
+    loadEditorForQuestion(question);
 }
 
 void MainWindow::onAddQuestion()
@@ -690,18 +1138,18 @@ void MainWindow::onAddQuestion()
     newQuestion["question"] = "💖 New Question 💖";
     newQuestion["options"] = QJsonArray{"Option A", "Option B"};
     newQuestion["answer"] = QJsonArray{0};
-    allQuestions.append(newQuestion);
-    refreshQuestionList();
-    if (questionListWidget) {
-        questionListWidget->setCurrentRow(allQuestions.size() - 1);
-    }
+    m_questionModel->appendQuestion(newQuestion);
+    m_journal.recordInsert(allQuestions.size() - 1, newQuestion);
+    indexQuestion(allQuestions.size() - 1, newQuestion);
+    selectQuestionRow(m_questionModel->rowOf(allQuestions.size() - 1));
 }
 
 // TODO: Proper fix!
 void MainWindow::onDeleteQuestion()
 {
     // 1. Get the row the user wants to delete DIRECTLY from the visual list.
-    const int rowToDelete = questionListWidget->currentRow();
+    const int visibleRow = questionListView ? questionListView->currentIndex().row() : -1;
+    const int rowToDelete = visibleRow < 0 ? -1 : m_questionModel->storeIndex(visibleRow);
 
     qDebug() << "--- Delete Button Clicked ---";
     qDebug() << "Visual row selected for deletion:" << rowToDelete;
@@ -720,24 +1168,25 @@ void MainWindow::onDeleteQuestion()
     // 3. Save any pending changes from the currently OPEN editor.
     saveCurrentQuestion();
 
-    // 4. Remove the question from our master data list using the DIRECT row index.
-    allQuestions.removeAt(rowToDelete);
-
-    // 5. If the deleted question was the one being edited, or one before it,
+    // 4. If the deleted question was the one being edited, or one before it,
     // we must adjust the editor's index to prevent it from pointing to the wrong question later.
+    // This has to happen first: removing the row moves the view's current row,
+    // which calls straight back into onQuestionSelected.
     if (rowToDelete < currentQuestionIndex) {
         currentQuestionIndex--;
     } else if (rowToDelete == currentQuestionIndex) {
         currentQuestionIndex = -1; // The edited question no longer exists.
     }
 
-    // 6. Refresh the visual list from the now-correct data.
-    refreshQuestionList();
+    // 5. Remove just that one row from the model (and so from our master data list).
+    m_searchIndex.remove(allQuestions.id(rowToDelete));
+    m_questionModel->removeQuestion(rowToDelete);
+    m_journal.recordRemove(rowToDelete);
 
-    // 7. Select the next logical item in the list.
-    if (!allQuestions.isEmpty()) {
-        int newIndexToSelect = qMin(rowToDelete, allQuestions.size() - 1);
-        questionListWidget->setCurrentRow(newIndexToSelect);
+    // 6. Select the next logical item in the list.
+    if (m_questionModel->rowCount() > 0) {
+        int newRowToSelect = qMin(visibleRow, m_questionModel->rowCount() - 1);
+        selectQuestionRow(newRowToSelect);
     } else {
         // If the list is now empty, just show the welcome message.
         showWelcomeMessage();
@@ -746,12 +1195,14 @@ void MainWindow::onDeleteQuestion()
 
 bool MainWindow::saveFile()
 {
+    if (m_activeLoader) return false; // Never write back a half-loaded file!
     if (currentFilePath.isEmpty()) return saveFileAs();
     return saveToFile(currentFilePath);
 }
 
 bool MainWindow::saveFileAs()
 {
+    if (m_activeLoader) return false;
     QString filePath = QFileDialog::getSaveFileName(this, tr("Save Question File"), "", tr("JSON Files (*.json);;All Files (*)"));
     if (filePath.isEmpty()) return false;
     return saveToFile(filePath);
@@ -760,33 +1211,199 @@ bool MainWindow::saveFileAs()
 bool MainWindow::saveToFile(const QString &filePath)
 {
     saveCurrentQuestion();
-    QJsonArray questionArray;
-    QFileInfo fileInfo(filePath);
-    QString saveDirectory = fileInfo.dir().path();
-    for (const QJsonObject &q : allQuestions) {
-        questionArray.append(q);
-    }
-    QJsonDocument doc(questionArray);
-    QFile file(filePath);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QMessageBox::warning(this, "Error", "Could not open file for writing.");
-        return false;
-    }
-    file.write(doc.toJson(QJsonDocument::Indented));
-    currentFilePath = filePath;
-    setWindowTitle(QString("💖 %1 - Wifey MOOC Editor 💖").arg(QFileInfo(filePath).fileName()));
-    QMessageBox::information(this, "Success!", "File saved successfully! 💕");
+    if (m_activeSaver) {
+        // One writer at a time; the newest request wins once the current one is done.
+        m_pendingSavePath = filePath;
+        m_pendingSaveDocument = allQuestions.document();
+        return true;
+    }
+    startSaving(filePath);
     return true;
 }
 
+void MainWindow::startSaving(const QString &filePath)
+{
+    // The worker gets a frozen snapshot, so editing can carry on while it writes.
+    QThread *thread = new QThread(this);
+    const QJsonDocument::JsonFormat format = compactJsonAction && compactJsonAction->isChecked()
+        ? QJsonDocument::Compact : QJsonDocument::Indented;
+    QuizSaver *saver = new QuizSaver(filePath, allQuestions.snapshot(format));
+    saver->moveToThread(thread);
+
+    connect(thread, &QThread::started, saver, &QuizSaver::run);
+    connect(saver, &QuizSaver::finished, this, &MainWindow::onSaverFinished);
+    connect(saver, &QuizSaver::failed, this, &MainWindow::onSaverFailed);
+    connect(saver, &QuizSaver::finished, thread, &QThread::quit);
+    connect(saver, &QuizSaver::failed, thread, &QThread::quit);
+    connect(thread, &QThread::finished, saver, &QObject::deleteLater);
+    connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+
+    m_activeSaver = saver;
+    m_savingFilePath = filePath;
+    m_savingDocument = allQuestions.document();
+    statusBar()->showMessage(QString("Saving %1... 💕").arg(QFileInfo(filePath).fileName()));
+    thread->start();
+}
+
+void MainWindow::onSaverFinished(const QuestionStore::Snapshot &snapshot, const QList<QuestionSpan> &spans, const QByteArray &source,
+                                 std::shared_ptr<QFile> sourceFile)
+{
+    if (sender() != m_activeSaver) return;
+    m_activeSaver = nullptr;
+
+    // Ignored by the store if a different file was opened in the meantime.
+    const bool sameDocument = snapshot.document == allQuestions.document();
+    const bool inSync = allQuestions.markSaved(snapshot, spans, source, sourceFile);
+    if (sameDocument) {
+        if (m_journal.quizPath() != m_savingFilePath) {
+            // Saved under a new name: the old file's journal has nothing left to recover.
+            m_journal.discard();
+            m_journal.open(m_savingFilePath);
+        }
+        // The file has caught up, so the journal starts over against it. Edits
+        // made while the save was writing aren't in the file and go back in.
+        m_journal.restart();
+        if (!inSync) m_journal.recordUnsaved(snapshot, allQuestions);
+        currentFilePath = m_savingFilePath;
+        ImageLoader::instance()->setMediaDir(QFileInfo(currentFilePath).absolutePath());
+        setWindowTitle(QString("💖 %1 - Wifey MOOC Editor 💖").arg(QFileInfo(currentFilePath).fileName()));
+    }
+    statusBar()->showMessage(QString("Saved %1! 💕").arg(QFileInfo(m_savingFilePath).fileName()), 4000);
+
+    startPendingSave();
+}
+
+// A queued save only ever writes the document it was asked for, and never
+// while a file is streaming in over it.
+void MainWindow::startPendingSave()
+{
+    if (m_pendingSavePath.isEmpty()) return;
+    const QString next = m_pendingSavePath;
+    m_pendingSavePath.clear();
+    const quint64 document = allQuestions.document();
+    if (m_activeLoader || m_pendingSaveDocument != document || m_savingDocument != document) {
+        statusBar()->showMessage("A queued save was skipped because a different file is open now.", 4000);
+        return;
+    }
+    startSaving(next);
+}
+
+void MainWindow::compactJournal()
+{
+    // Quietly folds the journal into the file; skipped while anything else touches it.
+    if (m_journal.recordCount() == 0 || currentFilePath.isEmpty() || m_activeLoader || m_activeSaver) return;
+    if (m_journal.quizPath() != currentFilePath) return;
+    startSaving(currentFilePath);
+}
+
+void MainWindow::onSaverFailed(const QString &message)
+{
+    if (sender() != m_activeSaver) return;
+    m_activeSaver = nullptr;
+    statusBar()->clearMessage();
+    // Failures still get a dialog: the file on disk is untouched, but the user has to know.
+    QMessageBox::warning(this, "Error", message);
+
+    startPendingSave();
+}
+
+// --- Search ---
+
+// The index is built from scratch once per file, off the UI thread. After
+// that every add, edit and delete keeps it up to date one question at a time.
+void MainWindow::startIndexing()
+{
+    if (m_indexCancelFlag) *m_indexCancelFlag = true; // Whatever it was building is stale now
+
+    QThread *thread = new QThread(this);
+    SearchIndexer *indexer = new SearchIndexer(allQuestions.snapshot(QJsonDocument::Indented));
+    indexer->moveToThread(thread);
+
+    connect(thread, &QThread::started, indexer, &SearchIndexer::run);
+    connect(indexer, &SearchIndexer::finished, this, &MainWindow::onIndexerFinished);
+    connect(indexer, &SearchIndexer::finished, thread, &QThread::quit);
+    connect(thread, &QThread::finished, indexer, &QObject::deleteLater);
+    connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+
+    m_activeIndexer = indexer;
+    m_indexCancelFlag = indexer->cancelFlag();
+    thread->start();
+}
+
+void MainWindow::onIndexerFinished(quint64 document, std::shared_ptr<SearchIndex> index)
+{
+    if (sender() != m_activeIndexer) return;
+    m_activeIndexer = nullptr;
+    m_indexCancelFlag.reset();
+    if (!index || document != allQuestions.document()) return;
+
+    // Questions edited, added or deleted while it was building are caught up here.
+    QSet<quint64> live;
+    live.reserve(allQuestions.size());
+    for (int i = 0; i < allQuestions.size(); ++i) {
+        const quint64 id = allQuestions.id(i);
+        live.insert(id);
+        if (!index->contains(id) || index->revisionOf(id) != allQuestions.revision(i))
+            index->update(id, allQuestions.revision(i), allQuestions.at(i));
+    }
+    for (quint64 id : index->ids()) {
+        if (!live.contains(id)) index->remove(id);
+    }
+    m_searchIndex = std::move(*index);
+    applySearch();
+}
+
+void MainWindow::indexQuestion(int index, const QJsonObject &question)
+{
+    // While the full build is running it'll pick this up when it finishes.
+    if (m_activeIndexer || index < 0 || index >= allQuestions.size()) return;
+    m_searchIndex.update(allQuestions.id(index), allQuestions.revision(index), question);
+}
+
+void MainWindow::resetSearch()
+{
+    if (m_indexCancelFlag) *m_indexCancelFlag = true;
+    m_activeIndexer = nullptr;
+    m_indexCancelFlag.reset();
+    m_searchIndex.clear();
+    if (m_searchBox) {
+        const QSignalBlocker blocker(m_searchBox);
+        m_searchBox->clear();
+    }
+    m_questionModel->clearFilter();
+}
+
+void MainWindow::applySearch()
+{
+    const QString query = m_searchBox ? m_searchBox->text().trimmed() : QString();
+    if (query.isEmpty()) {
+        m_questionModel->clearFilter();
+    } else if (m_activeIndexer) {
+        statusBar()->showMessage("Still indexing, hang on a sec... 🔍", 2000);
+        return; // Runs again once the index is in
+    } else {
+        m_questionModel->setFilter(m_searchIndex.search(query));
+    }
+
+    // Keep the open question highlighted if it's still in the list.
+    const int row = m_questionModel->rowOf(currentQuestionIndex);
+    if (questionListView && row >= 0) questionListView->setCurrentIndex(m_questionModel->index(row));
+}
+
 void MainWindow::newFile()
 {
     if (!allQuestions.isEmpty()) {
         if (QMessageBox::question(this, "New File", "Are you sure you want to create a new file? All unsaved changes will be lost!", QMessageBox::Yes | QMessageBox::No) == QMessageBox::No)
             return;
     }
+    cancelLoading();
+    m_pendingSavePath.clear();
+    m_journal.discard(); // They just agreed to lose those edits
+    resetSearch();
+    dropPreloadedEditors();
     allQuestions.clear();
     currentFilePath.clear();
+    ImageLoader::instance()->setMediaDir(QString());
     currentQuestionIndex = -1;
     refreshQuestionList();
     showWelcomeMessage();
@@ -807,6 +1424,9 @@ void MainWindow::createActions()
     saveAsAction = new QAction(tr("Save &As..."), this);
     saveAsAction->setShortcuts(QKeySequence::SaveAs);
     connect(saveAsAction, &QAction::triggered, this, &MainWindow::saveFileAs);
+    compactJsonAction = new QAction(tr("&Compact JSON Output"), this);
+    compactJsonAction->setCheckable(true);
+    compactJsonAction->setToolTip(tr("Write files without indentation. Smaller, but harder to read by hand."));
     exitAction = new QAction(tr("E&xit"), this);
     exitAction->setShortcuts(QKeySequence::Quit);
     connect(exitAction, &QAction::triggered, this, &QWidget::close);
@@ -819,26 +1439,8 @@ void MainWindow::createMenus()
     fileMenu->addAction(openAction);
     fileMenu->addAction(saveAction);
     fileMenu->addAction(saveAsAction);
+    fileMenu->addAction(compactJsonAction);
     fileMenu->addSeparator();
     fileMenu->addAction(exitAction);
 }
 
-void MainWindow::applyStylesheet()
-{
-    QString style =R"(
-        QMainWindow { background-color: #FFB6C1; }
-        QWidget { font-family: 'Arial'; font-size: 12pt; color: #8B008B; }
-        QMenuBar { background-color: #FFC0CB; }
-        QMenu { background-color: #FFC0CB; }
-        QPushButton { background-color: #FF1493; color: #FFFFFF; border-radius: 5px; padding: 8px 12px; font-weight: bold; }
-        QPushButton:hover { background-color: #FF69B4; }
-        QLabel { color: #8B008B; }
-        QLineEdit, QTextEdit, QPlainTextEdit { background-color: #FFEFD5; border: 1px solid #FFC0CB; border-radius: 5px; padding: 5px; }
-        QComboBox { background-color: #FFFFFF; border: 1px solid #FFC0CB; border-radius: 5px; padding: 5px; }
-        QGroupBox { border: 1px solid #FF69B4; border-radius: 5px; margin-top: 10px; font-weight: bold; }
-        QGroupBox::title { subcontrol-origin: margin; subcontrol-position: top center; padding: 0 3px; background-color: #FFB6C1; }
-        QListWidget { background-color: #FFEFD5; border: 1px solid #FFC0CB; }
-        QSplitter::handle { background-color: #FF69B4; }
-    )";
-    this->setStyleSheet(style);
-}
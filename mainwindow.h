@@ -6,25 +6,33 @@
 #include <QJsonObject>
 #include <QJsonArray>
 #include <memory>
+#include <atomic>
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkReply>
 #include "basequestioneditor.h"
 #include "mediahandler.h"
 #include "questionhandlers.h" // 💖 ADD THIS LINE 💖
+#include "questionstore.h"
+#include "editjournal.h"
+#include "searchindex.h"
 
 // Forward declarations to keep things super tidy!
 class QAction;
 class QMenu;
 class QComboBox;
 class QVBoxLayout;
-class QListWidget;
-class QListWidgetItem;
+class QListView;
 class QSplitter;
 class QLineEdit;
 class QTextEdit;
 class QLabel;
 class QCheckBox; // For our new offline mode toggle! ✨
 class QFrame;    // For showing/hiding UI sections!
+class QProgressBar;
+class QuizLoader;
+class QuizSaver;
+class QuestionListModel;
+class SearchIndexer;
 
 
 class MainWindow : public QMainWindow
@@ -44,7 +52,7 @@ private slots:
     void onAddQuestion();
     void onDeleteQuestion();
     void onQuestionTypeChanged(int index);
-    void onQuestionSelected(QListWidgetItem *item);
+    void onQuestionSelected(const QModelIndex &current);
 
     // --- New slots for our super cute AI Assistant! ---
     void showAiAssistantDialog();
@@ -54,19 +62,59 @@ private slots:
     void onProcessPastedJson();            // For processing the pasted text!
     void onLivePreview(); // 💖 ADD THIS LINE 💖
 
+    // --- Background loading of big quiz files ---
+    void onLoaderProgress(qint64 bytesDone, qint64 bytesTotal);
+    void onQuizSourceLoaded(const QByteArray &data);
+    void onQuestionsChunkLoaded(const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans);
+    void onLoaderRestarted();
+    void onLoaderFinished(bool cancelled);
+    void onLoaderFailed(const QString &message);
+    void cancelLoading();
+
+    // --- Background saving ---
+    void onSaverFinished(const QuestionStore::Snapshot &snapshot, const QList<QuestionSpan> &spans, const QByteArray &source,
+                         std::shared_ptr<QFile> sourceFile);
+    void onSaverFailed(const QString &message);
+    void compactJournal();
+
+    // --- Search ---
+    void applySearch();
+    void onIndexerFinished(quint64 document, std::shared_ptr<SearchIndex> index);
+
 private:
     // Original functions - untouched and perfect!
     void createActions();
     void createMenus();
     void setupMainLayout();
     void showWelcomeMessage();
-    void applyStylesheet();
     void clearEditorPanel();
     void loadEditorForQuestion(const QJsonObject &questionJson);
     bool saveToFile(const QString &filePath);
     void refreshQuestionList();
+    void selectQuestionRow(int row);
+    // question is what was just stored at index, so it needn't be decoded again.
+    void indexQuestion(int index, const QJsonObject &question);
+    void startIndexing();
+    void resetSearch();
     void saveCurrentQuestion();
 
+    // --- Background loading helpers ---
+    void startLoading(const QString &filePath);
+    void beginLoadedDocument();
+    void finishLoading();
+    void setLoadingUiActive(bool loading);
+    void startSaving(const QString &filePath);
+    void startPendingSave();
+    void journalSet(int index, const QJsonObject &question);
+    BaseQuestionEditor *takeEditor(const QString &type);
+    void releaseEditor(BaseQuestionEditor *editor);
+    void resetEditorScroll(BaseQuestionEditor *editor);
+    void schedulePreload();
+    void preloadNeighbours();
+    BaseQuestionEditor *takePreloadedEditor(int index);
+    void dropPreloadedEditors();
+    void runBenchmarks();
+
     // --- New AI helper functions! ---
     void loadPrompts();
     void processAIGeneratedQuestions(const QJsonArray &items);
@@ -77,9 +125,10 @@ private:
     QPushButton *saveButton;
     QPushButton *deleteButton;
     QComboBox *questionTypeSelector;
-    std::unique_ptr<QWidget> currentEditor;
-    QListWidget *questionListWidget;
-    QList<QJsonObject> allQuestions;
+    QWidget *currentEditor = nullptr; // Lives in the editor frame; pooled editors only get hidden
+    QListView *questionListView;
+    QuestionStore allQuestions;
+    QuestionListModel *m_questionModel = nullptr;
     int currentQuestionIndex;
     QString currentFilePath;
     QMenu *fileMenu;
@@ -87,11 +136,39 @@ private:
     QAction *openAction;
     QAction *saveAction;
     QAction *saveAsAction;
+    QAction *compactJsonAction = nullptr;
     QAction *exitAction;
     QVBoxLayout *mainEditorFrameLayout;
 
+    // Editors are built the first time a type is needed and then just
+    // reloaded, so switching questions doesn't rebuild every group box.
+    QHash<QString, QList<BaseQuestionEditor*>> m_idleEditors;
+    QHash<BaseQuestionEditor*, QString> m_editorTypes;
+    static constexpr int MAX_IDLE_EDITORS_PER_TYPE = 2;
+
+    // Hidden editors already holding the questions next to the current one.
+    struct PreloadedEditor
+    {
+        quint64 id = 0;
+        quint64 revision = 0; // Only a match while the question hasn't changed since
+        BaseQuestionEditor *editor = nullptr;
+    };
+    QList<PreloadedEditor> m_preloaded;
+    QTimer *m_preloadTimer = nullptr;
+    static constexpr int MAX_PRELOADED_EDITORS = 2; // The one above and the one below
+    static constexpr int PRELOAD_DELAY_MS = 150;
+    QLabel *m_welcomeLabel = nullptr;
+    struct EditorSwitchStats
+    {
+        int count = 0;
+        qint64 totalNs = 0;
+        qint64 worstNs = 0;
+    };
+    QHash<QString, EditorSwitchStats> m_editorSwitchStats; // Per type, for the WIFEY_BENCH log
+    static constexpr int BENCH_ROUNDS = 20;
+
     // --- New AI Assistant members! ---
-    QPushButton *aiButton;
+    QPushButton *aiButton = nullptr;
     QNetworkAccessManager *aiManager;
     QJsonObject promptTemplates;
 
@@ -107,6 +184,37 @@ private:
     QTextEdit *aiPromptOutputText;
     QTextEdit *aiResponseInputText;
     MediaHandler *m_mediaHandler;
+
+    // --- Background loading state ---
+    // m_activeLoader is only ever compared against sender(), never dereferenced,
+    // because the loader lives (and dies) on its own thread.
+    QuizLoader *m_activeLoader = nullptr;
+    std::shared_ptr<std::atomic_bool> m_loadCancelFlag;
+    QString m_loadingFilePath;
+    QByteArray m_loadingSource;
+    bool m_loadedAnyChunk = false;
+    QProgressBar *m_loadProgressBar = nullptr;
+    QPushButton *m_cancelLoadButton = nullptr;
+
+    // --- Background saving state ---
+    // Same rule as the loader: compared against sender(), never dereferenced.
+    QuizSaver *m_activeSaver = nullptr;
+    QString m_savingFilePath;
+    quint64 m_savingDocument = 0;
+    QString m_pendingSavePath; // A save requested while another was still writing
+    quint64 m_pendingSaveDocument = 0; // ...and the document it was asked for
+
+    // --- Crash recovery ---
+    EditJournal m_journal;
+    QTimer *m_journalCompactTimer = nullptr;
+    QSet<quint64> m_editedWhileLoading; // Ids of questions edited before the journal could open
+    static constexpr int JOURNAL_COMPACT_INTERVAL_MS = 5 * 60 * 1000;
+
+    // --- Search ---
+    QLineEdit *m_searchBox = nullptr;
+    SearchIndex m_searchIndex;
+    SearchIndexer *m_activeIndexer = nullptr; // Compared against sender() only
+    std::shared_ptr<std::atomic_bool> m_indexCancelFlag;
 };
 
 #endif // MAINWINDOW_H
@@ -1,4 +1,7 @@
 #include "mediahandler.h"
+#include "theme.h"
+#include "imageloader.h"
+#include "tiledimageview.h"
 
 #include <QDir>
 #include <QStandardPaths>
@@ -49,25 +52,30 @@ void MediaHandler::displayImage(const QString &imagePath, QLabel *imageLabel, in
     QString resolvedPath = resolveMediaPath(imagePath, m_baseMediaDir);
     if (!fileExists(resolvedPath)) {
         imageLabel->setText(QString("Image not found:\n%1").arg(imagePath));
-        imageLabel->setStyleSheet("color: red; border: 1px solid red; padding: 10px;");
+        Theme::setRole(imageLabel, "error");
         return;
     }
-    QPixmap pixmap(resolvedPath);
-    if (pixmap.isNull()) {
-        imageLabel->setText(QString("Failed to load image:\n%1").arg(imagePath));
-        imageLabel->setStyleSheet("color: red; border: 1px solid red; padding: 10px;");
-        return;
-    }
-    if (pixmap.width() > maxWidth) {
-        pixmap = pixmap.scaledToWidth(maxWidth, Qt::SmoothTransformation);
-    }
-    imageLabel->setPixmap(pixmap);
-    imageLabel->setScaledContents(false);
+
+    // Decoded on a worker at the size we show it; a placeholder until then.
+    imageLabel->setProperty("imagePath", QVariant());
     imageLabel->setAlignment(Qt::AlignCenter);
-    imageLabel->setCursor(Qt::PointingHandCursor);
-    imageLabel->setToolTip("Click to view full size");
-    imageLabel->setProperty("imagePath", resolvedPath);
-    imageLabel->installEventFilter(this);
+    imageLabel->setText("⏳ Loading image...");
+    imageLabel->setProperty("imageRequest", resolvedPath);
+    ImageLoader::instance()->load(resolvedPath, maxWidth, imageLabel, [this, imageLabel, imagePath, resolvedPath](const QPixmap &pixmap) {
+        // The label may have been handed another image while this one decoded.
+        if (imageLabel->property("imageRequest").toString() != resolvedPath) return;
+        if (pixmap.isNull()) {
+            imageLabel->setText(QString("Failed to load image:\n%1").arg(imagePath));
+            Theme::setRole(imageLabel, "error");
+            return;
+        }
+        imageLabel->setPixmap(pixmap);
+        imageLabel->setScaledContents(false);
+        imageLabel->setCursor(Qt::PointingHandCursor);
+        imageLabel->setToolTip("Click to view full size");
+        imageLabel->setProperty("imagePath", resolvedPath);
+        imageLabel->installEventFilter(this);
+    });
 }
 
 void MediaHandler::addMediaButtons(const QJsonObject &media, QWidget *parent, const QString &mediaDir)
@@ -426,83 +434,27 @@ void MediaHandler::createImagePreviewDialog(const QString &imagePath, QWidget *p
     dialog->setModal(false);
     dialog->setAttribute(Qt::WA_DeleteOnClose);
 
-    QPixmap pixmap(imagePath);
-    if (pixmap.isNull()) {
+    // Tiled, so a 20k pixel map opens instantly and only what's on screen
+    // is ever decoded.
+    TiledImageView *view = new TiledImageView(dialog);
+    if (!view->setImage(imagePath)) {
         QMessageBox::warning(parent, "Error",
             QString("Failed to load image:\n%1").arg(imagePath));
         delete dialog;
         return;
     }
-
-    QScrollArea *scrollArea = new QScrollArea(dialog);
-    scrollArea->setBackgroundRole(QPalette::Dark);
-    scrollArea->setAlignment(Qt::AlignCenter);
-
-    QLabel *imageLabel = new QLabel;
-    imageLabel->setPixmap(pixmap);
-    imageLabel->setScaledContents(false); // WE DO NOT want DSTRETCH
-    scrollArea->setWidget(imageLabel);
+    view->setBackgroundRole(QPalette::Dark);
+    view->setToolTip("🔍 Scroll to zoom, drag to look around, double-click for 1:1");
 
     QVBoxLayout *layout = new QVBoxLayout(dialog);
-    layout->addWidget(scrollArea);
-
-    bool *scaledMode = new bool(true); // true = scaled-to-window, false = 1:1
-
-    // Helper to show the pixmap at the right size/aspect.
-    auto fitLabelToViewport = [=]() {
-        if (*scaledMode) {
-            QSize avail = scrollArea->viewport()->size();
-            if (avail.width() > 2 && avail.height() > 2) {
-                QPixmap scaled = pixmap.scaled(avail, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-                imageLabel->setPixmap(scaled);
-                imageLabel->resize(scaled.size());
-            }
-        } else {
-            imageLabel->setPixmap(pixmap);
-            imageLabel->resize(pixmap.size());
-        }
-    };
-
-    // Event filter for resizing (scrollArea viewport)
-    class ViewportResizeFilter : public QObject {
-        std::function<void()> updateFn;
-    public:
-        ViewportResizeFilter(std::function<void()> fn, QObject *parent = nullptr)
-            : QObject(parent), updateFn(fn) {}
-        bool eventFilter(QObject *, QEvent *event) override {
-            if (event->type() == QEvent::Resize) {
-                updateFn();
-            }
-            return false;
-        }
-    };
-    scrollArea->viewport()->installEventFilter(new ViewportResizeFilter(fitLabelToViewport, scrollArea->viewport()));
-
-    // Toggle mode on image click
-    class ToggleFilter : public QObject {
-        std::function<void()> updateFn;
-        bool *mode;
-    public:
-        ToggleFilter(std::function<void()> fn, bool *m, QObject *parent=nullptr)
-            : QObject(parent), updateFn(fn), mode(m) {}
-        bool eventFilter(QObject *, QEvent *event) override {
-            if (event->type() == QEvent::MouseButtonRelease) {
-                *mode = !*mode;
-                updateFn();
-                return true;
-            }
-            return false;
-        }
-    };
-    imageLabel->setCursor(Qt::PointingHandCursor);
-    imageLabel->installEventFilter(new ToggleFilter(fitLabelToViewport, scaledMode, imageLabel));
-
-    // Initial sizing
-    QSize screen = QApplication::primaryScreen()->availableGeometry().size();
-    int maxW = qMin(pixmap.width() + 50, int(screen.width() * 0.9));
-    int maxH = qMin(pixmap.height() + 50, int(screen.height() * 0.9));
+    layout->addWidget(view);
+
+    // Initial sizing (a size that isn't known yet gets a roomy default)
+    const QSize screen = QApplication::primaryScreen()->availableGeometry().size();
+    const QSize imageSize = view->hasImage() ? view->imageSize() : screen * 0.6;
+    int maxW = qMin(imageSize.width() + 50, int(screen.width() * 0.9));
+    int maxH = qMin(imageSize.height() + 50, int(screen.height() * 0.9));
     dialog->resize(maxW, maxH);
-    fitLabelToViewport();
 
     dialog->show();
     dialog->raise();
@@ -0,0 +1,117 @@
+#include "parsecache.h"
+
+#include <QCborArray>
+#include <QCborMap>
+#include <QCborValue>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+QString QuizParseCache::directory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/parse-cache";
+}
+
+// One cache file per quiz path; the name is just a hash of the absolute path.
+QString QuizParseCache::cacheFileFor(const QString &filePath)
+{
+    const QByteArray key = QCryptographicHash::hash(QFileInfo(filePath).absoluteFilePath().toUtf8(),
+                                                    QCryptographicHash::Sha1).toHex();
+    return directory() + "/" + QString::fromLatin1(key) + ".cbor";
+}
+
+// Oldest first until we're back under the limit. Banks that haven't been
+// opened for a while are the ones that go; they just get scanned again.
+void QuizParseCache::evict()
+{
+    const QFileInfoList entries = QDir(directory()).entryInfoList(QDir::Files, QDir::Time | QDir::Reversed);
+    qint64 total = 0;
+    for (const QFileInfo &entry : entries) total += entry.size();
+    if (total <= MAX_BYTES) return;
+    for (const QFileInfo &entry : entries) {
+        if (total <= EVICT_TO_BYTES) break;
+        if (QFile::remove(entry.absoluteFilePath())) total -= entry.size();
+    }
+}
+
+bool QuizParseCache::load(const QString &filePath, const QDateTime &modified, qint64 size, QByteArray &contentHash,
+                          QList<QuestionSummary> &summaries, QList<QuestionSpan> &spans)
+{
+    QFile file(cacheFileFor(filePath));
+    if (!file.open(QIODevice::ReadOnly)) return false;
+
+    const QCborMap root = QCborValue::fromCbor(file.readAll()).toMap();
+    if (root.value(QStringLiteral("version")).toInteger() != FORMAT_VERSION) return false;
+    if (root.value(QStringLiteral("path")).toString() != QFileInfo(filePath).absoluteFilePath()) return false;
+    if (root.value(QStringLiteral("mtime")).toInteger() != modified.toMSecsSinceEpoch()) return false;
+    if (root.value(QStringLiteral("size")).toInteger() != size) return false;
+
+    // Both are stored flat: type, question, image, type... and offset, length...
+    const QCborArray cachedSummaries = root.value(QStringLiteral("summaries")).toArray();
+    const QCborArray cachedSpans = root.value(QStringLiteral("spans")).toArray();
+    const qsizetype count = cachedSpans.size() / 2;
+    if (cachedSpans.size() != count * 2 || cachedSummaries.size() != count * 3) return false;
+
+    summaries.clear();
+    spans.clear();
+    summaries.reserve(count);
+    spans.reserve(count);
+    for (qsizetype i = 0; i < count; ++i) {
+        QuestionSummary summary;
+        summary.setTypeName(cachedSummaries.at(3 * i).toString());
+        summary.question = cachedSummaries.at(3 * i + 1).toString();
+        summary.image = cachedSummaries.at(3 * i + 2).toString();
+        summaries.append(summary);
+        spans.append(QuestionSpan{cachedSpans.at(2 * i).toInteger(), cachedSpans.at(2 * i + 1).toInteger()});
+    }
+    contentHash = root.value(QStringLiteral("hash")).toByteArray();
+
+    // Touching it is what makes eviction least-recently-used.
+    file.close();
+    if (file.open(QIODevice::ReadWrite)) file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    return true;
+}
+
+bool QuizParseCache::store(const QString &filePath, const QDateTime &modified, qint64 size, const QByteArray &contentHash,
+                           const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans)
+{
+    const QString cachePath = cacheFileFor(filePath);
+    if (!QDir().mkpath(QFileInfo(cachePath).absolutePath())) return false;
+
+    QCborArray cachedSummaries;
+    for (const QuestionSummary &summary : summaries) {
+        cachedSummaries.append(summary.typeName());
+        cachedSummaries.append(summary.question);
+        cachedSummaries.append(summary.image);
+    }
+    QCborArray cachedSpans;
+    for (const QuestionSpan &span : spans) {
+        cachedSpans.append(span.offset);
+        cachedSpans.append(span.length);
+    }
+
+    QCborMap root;
+    root.insert(QStringLiteral("version"), FORMAT_VERSION);
+    root.insert(QStringLiteral("path"), QFileInfo(filePath).absoluteFilePath());
+    root.insert(QStringLiteral("mtime"), modified.toMSecsSinceEpoch());
+    root.insert(QStringLiteral("size"), size);
+    root.insert(QStringLiteral("hash"), contentHash);
+    root.insert(QStringLiteral("summaries"), cachedSummaries);
+    root.insert(QStringLiteral("spans"), cachedSpans);
+
+    // QSaveFile so a half-written cache can never be mistaken for a good one.
+    QSaveFile file(cachePath);
+    if (!file.open(QIODevice::WriteOnly)) return false;
+    file.write(QCborValue(root).toCbor());
+    if (!file.commit()) return false;
+    evict();
+    return true;
+}
+
+void QuizParseCache::remove(const QString &filePath)
+{
+    QFile::remove(cacheFileFor(filePath));
+}
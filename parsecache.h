@@ -0,0 +1,42 @@
+#ifndef PARSECACHE_H
+#define PARSECACHE_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QList>
+#include <QString>
+#include "questionstore.h"
+
+// The index of every quiz file we've scanned (each question's summary and
+// where its text sits), kept as CBOR in the user cache directory. Decoding
+// that is a lot cheaper than scanning the JSON text, so reopening an
+// unchanged bank skips the slow part entirely. An entry only counts as fresh
+// when the path, modification time, size and content hash all match.
+// There's one entry per path; the directory is kept under MAX_BYTES by
+// dropping the entries of the files opened least recently.
+class QuizParseCache
+{
+public:
+    // Matches on path, modification time and size, so it can be used while
+    // the file is still being read; contentHash says what the whole file
+    // has to hash to, for the caller to check once it has.
+    static bool load(const QString &filePath, const QDateTime &modified, qint64 size, QByteArray &contentHash,
+                     QList<QuestionSummary> &summaries, QList<QuestionSpan> &spans);
+    static bool store(const QString &filePath, const QDateTime &modified, qint64 size, const QByteArray &contentHash,
+                      const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans);
+    // For an entry that load() matched but whose hash turned out wrong: it's
+    // just a miss, and the next open shouldn't trip over it again.
+    static void remove(const QString &filePath);
+
+    static QString cacheFileFor(const QString &filePath);
+    static QString directory();
+
+private:
+    static void evict();
+
+    static constexpr int FORMAT_VERSION = 5;
+    static constexpr qint64 MAX_BYTES = 64 * 1024 * 1024;
+    static constexpr qint64 EVICT_TO_BYTES = MAX_BYTES / 4 * 3; // Some room, so we don't evict on every store
+};
+
+#endif // PARSECACHE_H
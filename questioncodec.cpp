@@ -0,0 +1,151 @@
+#include "questioncodec.h"
+
+#include <QCborArray>
+#include <QCborMap>
+#include <QCborValue>
+#include <QHash>
+#include <QJsonArray>
+#include <QStringList>
+
+namespace {
+
+const char *const TYPE_NAMES[] = {
+    "",
+    "mcq_single",
+    "mcq_multiple",
+    "word_fill",
+    "order_phrase",
+    "match_phrases",
+    "categorization_multiple",
+    "list_pick",
+    "image_tagging",
+    "match_sentence",
+    "sequence_audio",
+    "fill_blanks_dropdown",
+    "multi_questions",
+};
+constexpr int TYPE_COUNT = int(sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]));
+
+// Append only: the ids are just positions in this list. Nothing encoded
+// ever leaves the process, but there's no reason to reshuffle them either.
+const char *const KEYS[] = {
+    "type", "question", "options", "answer", "answers", "media", "lesson", "hint",
+    "image", "pdf", "video", "audio", "sentence_parts", "text", "pairs", "tags",
+    "categories", "stimuli", "audio_options", "alternatives", "questions",
+    "options_for_blanks", "image_path", "sentence", "id", "phrase_shuffled",
+    "option", "button_label", "source", "label", "targets", "optional_media",
+    "items", "parts", "max_columns", "left", "distracteurs", "words", "correct",
+};
+constexpr int KEY_COUNT = int(sizeof(KEYS) / sizeof(KEYS[0]));
+constexpr int TYPE_KEY = 0;
+
+// JSON only ever produces the false/true/null simple types, so the
+// unassigned range from 32 up is free to carry our type ids.
+constexpr int TYPE_SIMPLE_BASE = 32;
+
+const QHash<QString, int> &keyIds()
+{
+    static const QHash<QString, int> ids = [] {
+        QHash<QString, int> table;
+        for (int i = 0; i < KEY_COUNT; ++i) table.insert(QString::fromLatin1(KEYS[i]), i);
+        return table;
+    }();
+    return ids;
+}
+
+const QStringList &keyNames()
+{
+    static const QStringList names = [] {
+        QStringList list;
+        for (int i = 0; i < KEY_COUNT; ++i) list.append(QString::fromLatin1(KEYS[i]));
+        return list;
+    }();
+    return names;
+}
+
+QCborValue encodeValue(const QJsonValue &value);
+
+QCborMap encodeObject(const QJsonObject &object)
+{
+    QCborMap map;
+    for (auto it = object.constBegin(); it != object.constEnd(); ++it) {
+        const int id = keyIds().value(it.key(), -1);
+        const QCborValue key = id >= 0 ? QCborValue(id) : QCborValue(it.key());
+        if (id == TYPE_KEY && it.value().isString()) {
+            const QuestionType type = questionTypeFromName(it.value().toString());
+            if (type != QuestionType::Unknown) {
+                map.insert(key, QCborValue(QCborSimpleType(TYPE_SIMPLE_BASE + int(type))));
+                continue;
+            }
+        }
+        map.insert(key, encodeValue(it.value()));
+    }
+    return map;
+}
+
+QCborValue encodeValue(const QJsonValue &value)
+{
+    // Nested objects (multi_questions, tags, pairs...) get the same treatment.
+    if (value.isObject()) return encodeObject(value.toObject());
+    if (value.isArray()) {
+        QCborArray array;
+        for (const QJsonValue &item : value.toArray()) array.append(encodeValue(item));
+        return array;
+    }
+    return QCborValue::fromJsonValue(value);
+}
+
+QJsonValue decodeValue(const QCborValue &value);
+
+QJsonObject decodeObject(const QCborMap &map)
+{
+    QJsonObject object;
+    for (auto it = map.constBegin(); it != map.constEnd(); ++it) {
+        const QCborValue key = it.key();
+        const QString name = key.isInteger() ? keyNames().value(int(key.toInteger())) : key.toString();
+        const QCborValue value = it.value();
+        if (value.isSimpleType() && !value.isBool() && !value.isNull() && !value.isUndefined()) {
+            object.insert(name, questionTypeName(QuestionType(int(value.toSimpleType()) - TYPE_SIMPLE_BASE)));
+        } else {
+            object.insert(name, decodeValue(value));
+        }
+    }
+    return object;
+}
+
+QJsonValue decodeValue(const QCborValue &value)
+{
+    if (value.isMap()) return decodeObject(value.toMap());
+    if (value.isArray()) {
+        QJsonArray array;
+        for (const QCborValue &item : value.toArray()) array.append(decodeValue(item));
+        return array;
+    }
+    return value.toJsonValue();
+}
+
+} // namespace
+
+QuestionType questionTypeFromName(QStringView name)
+{
+    for (int i = 1; i < TYPE_COUNT; ++i) {
+        if (name == QLatin1String(TYPE_NAMES[i])) return QuestionType(i);
+    }
+    return QuestionType::Unknown;
+}
+
+QString questionTypeName(QuestionType type)
+{
+    const int index = int(type);
+    return index > 0 && index < TYPE_COUNT ? QString::fromLatin1(TYPE_NAMES[index]) : QString();
+}
+
+QByteArray QuestionCodec::encode(const QJsonObject &question)
+{
+    return QCborValue(encodeObject(question)).toCbor();
+}
+
+QJsonObject QuestionCodec::decode(const QByteArray &encoded)
+{
+    return decodeObject(QCborValue::fromCbor(encoded).toMap());
+}
@@ -0,0 +1,49 @@
+#ifndef QUESTIONCODEC_H
+#define QUESTIONCODEC_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QString>
+#include <QStringView>
+
+// Every question type the editor knows about, small enough to sit in a byte.
+enum class QuestionType : quint8
+{
+    Unknown = 0,
+    McqSingle,
+    McqMultiple,
+    WordFill,
+    OrderPhrase,
+    MatchPhrases,
+    Categorization,
+    ListPick,
+    ImageTagging,
+    MatchSentence,
+    SequenceAudio,
+    FillBlanksDropdown,
+    MultiQuestions,
+};
+
+QuestionType questionTypeFromName(QStringView name);
+QString questionTypeName(QuestionType type); // Empty for Unknown
+
+// Packs a question into compact CBOR for keeping it in memory. Keys the
+// editors use ("type", "question", "options", "media"...) become small
+// integers, and a known "type" value becomes a one-byte tag, so a question
+// costs little more than its actual text. Anything else (unknown keys,
+// unknown types) is stored as-is, so decode(encode(q)) == q always holds.
+//
+// This is the compact form for every type; there are no per-type structs on
+// purpose. Quiz files carry keys the editors don't know about, and a struct
+// per type would either drop those or need this generic form as a fallback
+// anyway, on top of twelve structs to keep in step with twelve editors.
+// Interned keys already take away most of what a QJsonObject costs (see the
+// WIFEY_BENCH store benchmark).
+class QuestionCodec
+{
+public:
+    static QByteArray encode(const QJsonObject &question);
+    static QJsonObject decode(const QByteArray &encoded);
+};
+
+#endif // QUESTIONCODEC_H
@@ -656,22 +656,22 @@ QWidget* QuestionHandlers::createImageTagging(const QJsonObject &question, QWidg
         QJsonObject tag = tagsA[i].toObject();
         QString tagId = tag["id"].toString();
         QString label = tag["label"].toString();
-        QPoint startPos(10, 10 + i * 40);
-        if (m_tagPositions.contains(QString::number(altIdx))) {
-            QVariantMap altMap = m_tagPositions[QString::number(altIdx)].toMap();
-            if (altMap.contains(tagId))
-                startPos = altMap[tagId].toPoint();
-        }
-        m_imageTaggingWidget->addTag(tagId, label, startPos);
-
-        connect(m_imageTaggingWidget, &ImageTaggingWidget::tagPositionChanged,
-                this, [this, altIdx](const QString &tId, const QPoint &pos) {
-            QVariantMap altMap = m_tagPositions[QString::number(altIdx)].toMap();
-            altMap[tId] = pos;
-            m_tagPositions[QString::number(altIdx)] = altMap;
-        });
+        // Positions are in image coordinates; unplaced tags line up down the left.
+        QVariantMap altMap = m_tagPositions.value(QString::number(altIdx)).toMap();
+        if (altMap.contains(tagId))
+            m_imageTaggingWidget->addTag(tagId, label, altMap[tagId].toPoint());
+        else
+            m_imageTaggingWidget->addTag(tagId, label);
     }
 
+    // Once for all tags, not once per tag: every drag step ran all of them.
+    connect(m_imageTaggingWidget, &ImageTaggingWidget::tagPositionChanged,
+            this, [this, altIdx](const QString &tId, const QPoint &pos) {
+        QVariantMap altMap = m_tagPositions[QString::number(altIdx)].toMap();
+        altMap[tId] = pos;
+        m_tagPositions[QString::number(altIdx)] = altMap;
+    });
+
     if (question.contains("alternatives")) {
         m_imageTaggingAlternatives = question["alternatives"].toArray();
     } else {
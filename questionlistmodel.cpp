@@ -0,0 +1,217 @@
+#include "questionlistmodel.h"
+#include "imageloader.h"
+
+#include <algorithm>
+#include <numeric>
+
+QuestionListModel::QuestionListModel(QuestionStore *store, QObject *parent)
+    : QAbstractListModel(parent),
+      m_store(store)
+{}
+
+int QuestionListModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) return 0;
+    return m_filtered ? m_rows.size() : m_store->size();
+}
+
+QVariant QuestionListModel::data(const QModelIndex &index, int role) const
+{
+    if ((role != Qt::DisplayRole && role != Qt::DecorationRole) || !index.isValid()) return QVariant();
+    const int question = storeIndex(index.row());
+    if (question < 0 || question >= m_store->size()) return QVariant();
+
+    const QuestionSummary &summary = m_store->summary(question);
+    if (role == Qt::DecorationRole) return thumbnail(index, summary.image);
+
+    QString type = summary.typeName();
+    if (type.isEmpty()) type = "unknown";
+    QString text = summary.question.isEmpty() ? QString("No question text.") : summary.question;
+    if (text.length() > 30) text = text.left(30) + "...";
+    return QString("%1. [%2] %3").arg(question + 1).arg(type).arg(text);
+}
+
+// The question's picture, if it has one. Decoding happens off the GUI thread
+// (and usually not at all, thanks to the thumbnail cache); the row just
+// repaints once it's ready.
+QVariant QuestionListModel::thumbnail(const QModelIndex &index, const QString &image) const
+{
+    if (image.isEmpty()) return QVariant();
+    ImageLoader *loader = ImageLoader::instance();
+    const QString path = loader->resolve(image);
+    const QPixmap pixmap = loader->cached(path, THUMBNAIL_SIZE);
+    if (!pixmap.isNull()) return pixmap;
+
+    auto self = const_cast<QuestionListModel*>(this);
+    const QPersistentModelIndex row(index);
+    loader->load(path, THUMBNAIL_SIZE, self, [self, row](const QPixmap &loaded) {
+        if (!loaded.isNull() && row.isValid()) emit self->dataChanged(row, row, {Qt::DecorationRole});
+    });
+    return QVariant();
+}
+
+int QuestionListModel::rowOf(int storeIndex) const
+{
+    if (!m_filtered) return storeIndex;
+    const auto it = std::lower_bound(m_rows.cbegin(), m_rows.cend(), storeIndex);
+    return it != m_rows.cend() && *it == storeIndex ? int(it - m_rows.cbegin()) : -1;
+}
+
+bool QuestionListModel::passesFilter(int storeIndex) const
+{
+    return std::binary_search(m_filterIds.cbegin(), m_filterIds.cend(), m_store->id(storeIndex));
+}
+
+void QuestionListModel::rebuildRows()
+{
+    m_rows.clear();
+    if (!m_filtered) return;
+    for (int i = 0; i < m_store->size(); ++i) {
+        if (passesFilter(i)) m_rows.append(i);
+    }
+}
+
+void QuestionListModel::setFilter(const QList<quint64> &ids)
+{
+    if (!m_filtered) {
+        // Same rows as unfiltered, just spelled out, so the diff has something to start from.
+        m_rows.resize(m_store->size());
+        std::iota(m_rows.begin(), m_rows.end(), 0);
+        m_filtered = true;
+    }
+    m_filterIds = ids;
+
+    QList<int> rows;
+    for (int i = 0; i < m_store->size(); ++i) {
+        if (passesFilter(i)) rows.append(i);
+    }
+    applyRows(rows);
+}
+
+// Gets from m_rows to rows (both ascending) with row removals and insertions,
+// so the view keeps its place and only lays out what changed. Past
+// MAX_DIFF_RUNS separate runs one reset is cheaper than all those signals.
+void QuestionListModel::applyRows(const QList<int> &rows)
+{
+    struct Run { int first; int count; };
+    QList<Run> removed; // Positions in m_rows
+    QList<Run> added;   // Positions in rows
+    auto extend = [](QList<Run> &runs, int position) {
+        if (!runs.isEmpty() && runs.last().first + runs.last().count == position) {
+            ++runs.last().count;
+        } else {
+            runs.append({position, 1});
+        }
+    };
+
+    int oldPos = 0;
+    int newPos = 0;
+    while (oldPos < m_rows.size() || newPos < rows.size()) {
+        if (newPos == rows.size() || (oldPos < m_rows.size() && m_rows[oldPos] < rows[newPos])) {
+            extend(removed, oldPos++);
+        } else if (oldPos == m_rows.size() || rows[newPos] < m_rows[oldPos]) {
+            extend(added, newPos++);
+        } else {
+            ++oldPos;
+            ++newPos;
+        }
+        if (removed.size() + added.size() > MAX_DIFF_RUNS) {
+            beginResetModel();
+            m_rows = rows;
+            endResetModel();
+            return;
+        }
+    }
+
+    // Back to front, so the runs still to go keep their positions.
+    for (auto it = removed.crbegin(); it != removed.crend(); ++it) {
+        beginRemoveRows(QModelIndex(), it->first, it->first + it->count - 1);
+        m_rows.remove(it->first, it->count);
+        endRemoveRows();
+    }
+    // Front to back: everything before a run is already in place by then.
+    for (const Run &run : std::as_const(added)) {
+        beginInsertRows(QModelIndex(), run.first, run.first + run.count - 1);
+        m_rows.insert(run.first, run.count, 0);
+        std::copy_n(rows.cbegin() + run.first, run.count, m_rows.begin() + run.first);
+        endInsertRows();
+    }
+}
+
+void QuestionListModel::clearFilter()
+{
+    if (!m_filtered) return;
+    beginResetModel();
+    m_filtered = false;
+    m_filterIds.clear();
+    m_rows.clear();
+    endResetModel();
+}
+
+void QuestionListModel::appendQuestion(const QJsonObject &question)
+{
+    const int row = rowCount();
+    beginInsertRows(QModelIndex(), row, row);
+    m_store->append(question);
+    if (m_filtered) {
+        m_filterIds.append(m_store->id(m_store->size() - 1)); // Newest id, so still sorted
+        m_rows.append(m_store->size() - 1);
+    }
+    endInsertRows();
+}
+
+void QuestionListModel::appendIndexed(const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans)
+{
+    if (summaries.isEmpty()) return;
+    if (m_filtered) {
+        // Not in the search results yet; the index hasn't seen them.
+        m_store->appendIndexed(summaries, spans);
+        return;
+    }
+    const int first = m_store->size();
+    beginInsertRows(QModelIndex(), first, first + summaries.size() - 1);
+    m_store->appendIndexed(summaries, spans);
+    endInsertRows();
+}
+
+bool QuestionListModel::replaceQuestion(int storeIndex, const QJsonObject &question)
+{
+    if (!m_store->replace(storeIndex, question)) return false;
+    const int row = rowOf(storeIndex);
+    if (row >= 0) {
+        const QModelIndex changed = index(row);
+        emit dataChanged(changed, changed, {Qt::DisplayRole});
+    }
+    return true;
+}
+
+void QuestionListModel::removeQuestion(int storeIndex)
+{
+    const int row = rowOf(storeIndex);
+    if (row >= 0) beginRemoveRows(QModelIndex(), row, row);
+    const auto filterId = std::lower_bound(m_filterIds.begin(), m_filterIds.end(), m_store->id(storeIndex));
+    if (filterId != m_filterIds.end() && *filterId == m_store->id(storeIndex)) m_filterIds.erase(filterId);
+    m_store->removeAt(storeIndex);
+    if (m_filtered) {
+        if (row >= 0) m_rows.removeAt(row);
+        // Everything after the removed question moved up one place in the store.
+        for (int &visible : m_rows) {
+            if (visible > storeIndex) --visible;
+        }
+    }
+    if (row >= 0) endRemoveRows();
+
+    // Labels carry their number, so every row below changed too.
+    const int firstBelow = m_filtered
+        ? int(std::lower_bound(m_rows.cbegin(), m_rows.cend(), storeIndex) - m_rows.cbegin())
+        : storeIndex;
+    if (firstBelow < rowCount())
+        emit dataChanged(index(firstBelow), index(rowCount() - 1), {Qt::DisplayRole});
+}
+
+void QuestionListModel::reload()
+{
+    beginResetModel();
+    rebuildRows();
+    endResetModel();
+}
@@ -0,0 +1,62 @@
+#ifndef QUESTIONLISTMODEL_H
+#define QUESTIONLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QJsonObject>
+#include <QList>
+#include "questionstore.h"
+
+// The question list on the left, as a model over the QuestionStore. Labels
+// are built in data() from the question summaries, so only rows the view
+// actually paints cost anything. Changes go through the model so the view
+// only ever hears about the rows that moved.
+//
+// A filter (the search box) can hide questions. Rows are then no longer the
+// same as store indices, so anything talking to the store maps through
+// storeIndex() / rowOf().
+class QuestionListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit QuestionListModel(QuestionStore *store, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    static constexpr int THUMBNAIL_SIZE = 32;
+
+    int storeIndex(int row) const { return m_filtered ? m_rows.value(row, -1) : row; }
+    int rowOf(int storeIndex) const; // -1 when filtered out
+
+    // Shows only the questions with these ids (ascending, as SearchIndex
+    // hands them out). Questions added afterwards are shown too, so nobody
+    // loses track of what they just created.
+    void setFilter(const QList<quint64> &ids);
+    void clearFilter();
+    bool isFiltered() const { return m_filtered; }
+
+    void appendQuestion(const QJsonObject &question);
+    void appendIndexed(const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans);
+    // Returns false when the question didn't actually change.
+    bool replaceQuestion(int storeIndex, const QJsonObject &question);
+    void removeQuestion(int storeIndex);
+
+    // For when the store was changed wholesale (new file, replayed journal...).
+    void reload();
+
+private:
+    bool passesFilter(int storeIndex) const;
+    void rebuildRows();
+    void applyRows(const QList<int> &rows);
+    QVariant thumbnail(const QModelIndex &index, const QString &image) const;
+
+    QuestionStore *m_store;
+    bool m_filtered = false;
+    QList<quint64> m_filterIds; // Ascending
+    QList<int> m_rows; // Store indices of the visible questions, ascending
+
+    static constexpr int MAX_DIFF_RUNS = 64;
+};
+
+#endif // QUESTIONLISTMODEL_H
@@ -0,0 +1,177 @@
+#include "questionstore.h"
+
+#include <QHash>
+
+void QuestionSummary::setTypeName(const QString &name)
+{
+    type = questionTypeFromName(name);
+    otherType = type == QuestionType::Unknown ? name : QString();
+}
+
+QuestionSummary QuestionSummary::of(const QJsonObject &question)
+{
+    QuestionSummary summary;
+    summary.setTypeName(question["type"].toString());
+    summary.question = question["question"].toString();
+    summary.image = question["media"].toObject()["image"].toString();
+    return summary;
+}
+
+QuestionStore::QuestionStore()
+    : m_decoded(DECODED_CACHE_SIZE)
+{}
+
+QByteArray QuestionStore::textOf(const Entry &entry) const
+{
+    if (entry.span.offset < 0) return QByteArray();
+    return QByteArray::fromRawData(m_source.constData() + entry.span.offset, entry.span.length);
+}
+
+QJsonObject QuestionStore::at(int index) const
+{
+    const Entry &entry = m_entries.at(index);
+    if (const QJsonObject *cached = m_decoded.object(entry.revision)) return *cached;
+
+    const QJsonObject question = entry.dirty ? QuestionCodec::decode(entry.encoded)
+                                             : QJsonDocument::fromJson(textOf(entry)).object();
+    m_decoded.insert(entry.revision, new QJsonObject(question));
+    return question;
+}
+
+void QuestionStore::append(const QJsonObject &question)
+{
+    insert(m_entries.size(), question);
+}
+
+void QuestionStore::insert(int index, const QJsonObject &question)
+{
+    Entry entry;
+    entry.summary = QuestionSummary::of(question);
+    entry.encoded = QuestionCodec::encode(question);
+    entry.id = m_nextId++;
+    entry.revision = m_nextRevision++;
+    m_entries.insert(index, entry);
+}
+
+void QuestionStore::appendIndexed(const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans)
+{
+    m_entries.reserve(m_entries.size() + summaries.size());
+    for (int i = 0; i < summaries.size(); ++i) {
+        Entry entry;
+        entry.summary = summaries[i];
+        entry.id = m_nextId++;
+        entry.revision = m_nextRevision++;
+        // A span outside the source leaves nothing to decode; the entry just stays empty.
+        if (i < spans.size() && spans[i].offset >= 0 && spans[i].offset + spans[i].length <= m_source.size()) {
+            entry.span = spans[i];
+            entry.dirty = false;
+        }
+        m_entries.append(entry);
+    }
+}
+
+bool QuestionStore::replace(int index, const QJsonObject &question)
+{
+    // Selecting a question round-trips it through its editor; only real edits count.
+    if (at(index) == question) return false;
+    Entry &entry = m_entries[index];
+    entry.summary = QuestionSummary::of(question);
+    entry.encoded = QuestionCodec::encode(question);
+    entry.span = QuestionSpan();
+    entry.revision = m_nextRevision++;
+    entry.dirty = true;
+    return true;
+}
+
+void QuestionStore::setSource(const QByteArray &source)
+{
+    m_source = source;
+    m_sourceFile.reset();
+    m_format = QJsonDocument::Indented;
+}
+
+void QuestionStore::removeAt(int index)
+{
+    m_entries.removeAt(index);
+}
+
+void QuestionStore::clear()
+{
+    m_entries.clear();
+    m_decoded.clear();
+    m_source.clear();
+    m_sourceFile.reset();
+    m_format = QJsonDocument::Indented;
+    ++m_document; // Saves still running for the old document must not land here
+}
+
+int QuestionStore::dirtyCount() const
+{
+    int count = 0;
+    for (const Entry &entry : m_entries) {
+        if (entry.dirty) ++count;
+    }
+    return count;
+}
+
+QuestionStore::Snapshot QuestionStore::snapshot(QJsonDocument::JsonFormat format) const
+{
+    Snapshot snap;
+    snap.source = m_source;
+    snap.sourceFile = m_sourceFile;
+    snap.document = m_document;
+    snap.format = format;
+    snap.items.reserve(m_entries.size());
+    const bool reusable = format == m_format;
+    for (const Entry &entry : m_entries) {
+        Snapshot::Item item;
+        item.summary = entry.summary;
+        item.id = entry.id;
+        item.revision = entry.revision;
+        if (entry.dirty) {
+            item.encoded = entry.encoded;
+        } else {
+            // Decoding (if the format changed) is left to the saver's thread.
+            item.text = textOf(entry);
+            item.reusable = reusable;
+        }
+        snap.items.append(item);
+    }
+    return snap;
+}
+
+bool QuestionStore::markSaved(const Snapshot &snapshot, const QList<QuestionSpan> &spans, const QByteArray &source,
+                              const std::shared_ptr<QFile> &sourceFile)
+{
+    if (snapshot.document != m_document || spans.size() != snapshot.items.size() || source.isEmpty()) return false;
+
+    QHash<quint64, QuestionSpan> savedSpans;
+    savedSpans.reserve(spans.size());
+    for (int i = 0; i < spans.size(); ++i) {
+        if (spans[i].offset >= 0 && spans[i].offset + spans[i].length <= source.size())
+            savedSpans.insert(snapshot.items[i].revision, spans[i]);
+    }
+
+    // Anything edited or added while the save was writing has a revision the
+    // snapshot never saw, and is still dirty. A clean one the file somehow
+    // doesn't have gets packed before its old text goes away with m_source.
+    bool inSync = m_entries.size() == snapshot.items.size();
+    for (int i = 0; i < m_entries.size(); ++i) {
+        Entry &entry = m_entries[i];
+        const auto it = savedSpans.constFind(entry.revision);
+        if (it != savedSpans.cend()) {
+            entry.encoded.clear();
+            entry.span = it.value();
+            entry.dirty = false;
+        } else if (!entry.dirty) {
+            entry.encoded = QuestionCodec::encode(at(i));
+            entry.span = QuestionSpan();
+            entry.dirty = true;
+        }
+        if (entry.dirty || (inSync && snapshot.items[i].revision != entry.revision)) inSync = false;
+    }
+    m_source = source;
+    m_sourceFile = sourceFile;
+    m_format = snapshot.format;
+    return inSync;
+}
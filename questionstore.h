@@ -0,0 +1,138 @@
+#ifndef QUESTIONSTORE_H
+#define QUESTIONSTORE_H
+
+#include <QByteArray>
+#include <QCache>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QList>
+#include <QMetaType>
+#include <QString>
+#include <memory>
+#include "questioncodec.h"
+
+// Where a question's JSON text sits inside the file it was loaded from.
+struct QuestionSpan
+{
+    qint64 offset = -1;
+    qint64 length = 0;
+};
+Q_DECLARE_TYPEINFO(QuestionSpan, Q_PRIMITIVE_TYPE);
+Q_DECLARE_METATYPE(QuestionSpan)
+
+// Just enough of a question to show it in the list without decoding it.
+// Known types are a one-byte enum; only odd ones keep their name around.
+struct QuestionSummary
+{
+    QuestionType type = QuestionType::Unknown;
+    QString otherType; // Only set when type is Unknown
+    QString question;
+    QString image; // media.image, for the list's thumbnail
+
+    QString typeName() const { return type == QuestionType::Unknown ? otherType : questionTypeName(type); }
+    void setTypeName(const QString &name);
+
+    static QuestionSummary of(const QJsonObject &question);
+};
+Q_DECLARE_METATYPE(QuestionSummary)
+
+// Holds every question of the open file. Questions that came from the file
+// are kept as their JSON text plus a summary; edited ones are packed with
+// QuestionCodec. Either way they're only turned into a QJsonObject when an
+// editor (or the saver) asks for one, and the most recently read ones are
+// kept around in a small LRU cache. Storing a question doesn't put it in that
+// cache: whoever stored it still has the object. A question only gets
+// re-serialized after it changed; everything else is written back from its
+// text, so saving after one edit costs one question.
+class QuestionStore
+{
+public:
+    // A frozen copy of the store for saving on another thread. Everything in
+    // here is implicitly shared, so taking one is cheap and later edits to
+    // the store never touch it.
+    struct Snapshot
+    {
+        struct Item
+        {
+            QuestionSummary summary;
+            QByteArray encoded;    // QuestionCodec form, only for questions with no text yet
+            QByteArray text;       // Element text as cached, in the store's format
+            bool reusable = false; // text is already in the format being written
+            quint64 id = 0;
+            quint64 revision = 0;
+        };
+        QList<Item> items;
+        QByteArray source;        // Keeps the slices in items[].text alive
+        std::shared_ptr<QFile> sourceFile; // ...and this keeps source alive, when it's mapped
+        quint64 document = 0;
+        QJsonDocument::JsonFormat format = QJsonDocument::Indented;
+    };
+
+    static constexpr int DECODED_CACHE_SIZE = 64;
+
+    QuestionStore();
+
+    int size() const { return m_entries.size(); }
+    bool isEmpty() const { return m_entries.isEmpty(); }
+    // Decodes on demand. Comes back empty if the stored text isn't valid JSON.
+    QJsonObject at(int index) const;
+    const QuestionSummary &summary(int index) const { return m_entries.at(index).summary; }
+    // Stays with the question for as long as it exists, through edits and moves.
+    quint64 id(int index) const { return m_entries.at(index).id; }
+    quint64 revision(int index) const { return m_entries.at(index).revision; }
+
+    void append(const QJsonObject &question);
+    // Questions straight from the file scan: summaries + where their text is in the source.
+    void appendIndexed(const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans);
+    void insert(int index, const QJsonObject &question);
+    // Returns false when the question didn't actually change.
+    bool replace(int index, const QJsonObject &question);
+    void removeAt(int index);
+    void clear();
+
+    // The raw bytes of the loaded file, so clean questions can be copied verbatim.
+    // They're kept as they are, so they only get reused for indented output.
+    void setSource(const QByteArray &source);
+
+    bool isDirty(int index) const { return m_entries.at(index).dirty; }
+    int dirtyCount() const;
+
+    // Changes whenever the store is cleared for a different file.
+    quint64 document() const { return m_document; }
+
+    Snapshot snapshot(QJsonDocument::JsonFormat format) const;
+    // After a snapshot hit the disk, source (the file as written) becomes the
+    // text for every question that hasn't been edited since, at spans (one
+    // per item). If source is the file mapped into memory, sourceFile is what
+    // keeps it mapped. Returns true when the store now matches the file.
+    bool markSaved(const Snapshot &snapshot, const QList<QuestionSpan> &spans, const QByteArray &source,
+                   const std::shared_ptr<QFile> &sourceFile = nullptr);
+
+private:
+    struct Entry
+    {
+        QuestionSummary summary;
+        QByteArray encoded;    // QuestionCodec form, only while there's no text to decode it from
+        QuestionSpan span;     // Still-valid slice of m_source, if any
+        quint64 id = 0;
+        quint64 revision = 0;  // Bumped on every change, so a save can tell what moved on
+        bool dirty = true;     // No text yet: needs serializing on the next save
+    };
+
+    QByteArray textOf(const Entry &entry) const;
+
+    QList<Entry> m_entries;
+    QByteArray m_source;
+    std::shared_ptr<QFile> m_sourceFile; // Only when m_source is a mapped file
+    QJsonDocument::JsonFormat m_format = QJsonDocument::Indented; // Of everything cached
+    quint64 m_nextRevision = 1;
+    quint64 m_nextId = 1;
+    quint64 m_document = 1;
+    // Keyed by revision, so stale decodes simply never get asked for again.
+    mutable QCache<quint64, QJsonObject> m_decoded;
+};
+Q_DECLARE_METATYPE(QuestionStore::Snapshot)
+Q_DECLARE_METATYPE(std::shared_ptr<QFile>)
+
+#endif // QUESTIONSTORE_H
@@ -0,0 +1,321 @@
+#include "quizloader.h"
+#include "parsecache.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+// ---------- SCANNER ----------
+QuizScanner::QuizScanner(const QByteArray &data, bool streaming)
+    : m_data(data),
+      m_available(streaming ? 0 : data.size()),
+      m_pos(0),
+      m_started(false),
+      m_done(false),
+      m_complete(!streaming)
+{}
+
+qsizetype QuizScanner::skipWhitespace(qsizetype pos) const
+{
+    const char *p = m_data.constData();
+    const qsizetype size = m_available;
+    while (pos < size && (p[pos] == ' ' || p[pos] == '\n' || p[pos] == '\r' || p[pos] == '\t'))
+        ++pos;
+    return pos;
+}
+
+// Returns the offset just past the JSON value starting at pos, or -1 if the
+// value never ends (or doesn't end yet). Strings are skipped whole so
+// brackets inside them don't count.
+qsizetype QuizScanner::valueEnd(qsizetype pos) const
+{
+    const char *p = m_data.constData();
+    const qsizetype size = m_available;
+    const char first = p[pos];
+
+    if (first == '{' || first == '[') {
+        int depth = 0;
+        bool inString = false;
+        for (qsizetype i = pos; i < size; ++i) {
+            const char c = p[i];
+            if (inString) {
+                if (c == '\\') ++i;
+                else if (c == '"') inString = false;
+                continue;
+            }
+            if (c == '"') inString = true;
+            else if (c == '{' || c == '[') ++depth;
+            else if ((c == '}' || c == ']') && --depth == 0) return i + 1;
+        }
+        return -1;
+    }
+
+    if (first == '"') {
+        for (qsizetype i = pos + 1; i < size; ++i) {
+            if (p[i] == '\\') ++i;
+            else if (p[i] == '"') return i + 1;
+        }
+        return -1;
+    }
+
+    // Numbers, true, false and null just run until the next separator.
+    qsizetype i = pos;
+    while (i < size && p[i] != ',' && p[i] != ']' && p[i] != '}' && p[i] != ' ' && p[i] != '\n' && p[i] != '\r' && p[i] != '\t')
+        ++i;
+    if (i == size && !m_complete) return -1; // The number might go on in the next block
+    return i == pos ? -1 : i;
+}
+
+QString QuizScanner::decodeString(qsizetype pos, qsizetype length) const
+{
+    const QByteArray raw = QByteArray::fromRawData(m_data.constData() + pos, length);
+    if (!raw.contains('\\')) return QString::fromUtf8(raw.constData() + 1, length - 2);
+    // Escapes are rare enough to just let QJsonDocument deal with them.
+    return QJsonDocument::fromJson("[" + raw + "]").array().at(0).toString();
+}
+
+// Calls fn(key, valuePos, valueStop) for each member of the object at start,
+// stopping quietly at anything that doesn't look right.
+template<typename Fn>
+void QuizScanner::forEachMember(qsizetype start, qsizetype length, Fn fn) const
+{
+    const qsizetype end = start + length - 1; // The closing brace
+    qsizetype pos = skipWhitespace(start + 1);
+    while (pos < end && m_data.at(pos) == '"') {
+        const qsizetype keyEnd = valueEnd(pos);
+        if (keyEnd < 0 || keyEnd > end) break;
+        const QByteArray key = QByteArray::fromRawData(m_data.constData() + pos + 1, keyEnd - pos - 2);
+
+        pos = skipWhitespace(keyEnd);
+        if (pos >= end || m_data.at(pos) != ':') break;
+        pos = skipWhitespace(pos + 1);
+        const qsizetype valueStop = valueEnd(pos);
+        if (valueStop < 0 || valueStop > end) break;
+
+        fn(key, pos, valueStop);
+
+        pos = skipWhitespace(valueStop);
+        if (pos >= end || m_data.at(pos) != ',') break;
+        pos = skipWhitespace(pos + 1);
+    }
+}
+
+QuestionSummary QuizScanner::summarize(qsizetype start, qsizetype length) const
+{
+    QuestionSummary summary;
+    // Later duplicates win, same as QJsonObject.
+    forEachMember(start, length, [&](const QByteArray &key, qsizetype pos, qsizetype valueStop) {
+        if (m_data.at(pos) == '"') {
+            if (key == "type") summary.setTypeName(decodeString(pos, valueStop - pos));
+            else if (key == "question") summary.question = decodeString(pos, valueStop - pos);
+        } else if (key == "media" && m_data.at(pos) == '{') {
+            summary.image.clear();
+            forEachMember(pos, valueStop - pos, [&](const QByteArray &mediaKey, qsizetype mediaPos, qsizetype mediaStop) {
+                if (mediaKey == "image" && m_data.at(mediaPos) == '"') summary.image = decodeString(mediaPos, mediaStop - mediaPos);
+            });
+        }
+    });
+    return summary;
+}
+
+bool QuizScanner::fail(const QString &message)
+{
+    m_error = message;
+    m_done = true;
+    return false;
+}
+
+// Out of data: an error once the file is all there, otherwise just "not yet".
+bool QuizScanner::waitOrFail(const QString &message)
+{
+    return m_complete ? fail(message) : false;
+}
+
+// Nothing is consumed until a whole element (and what follows it) is
+// available, so after a "not yet" the same call simply works later.
+bool QuizScanner::next(qsizetype &start, qsizetype &length)
+{
+    if (m_done) return false;
+
+    const qsizetype size = m_available;
+    if (!m_started) {
+        if (size < 3 && !m_complete) return false; // Not even enough to spot a BOM
+        qsizetype pos = 0;
+        if (size >= 3 && m_data.startsWith("\xEF\xBB\xBF")) pos = 3; // UTF-8 BOM
+        pos = skipWhitespace(pos);
+        if (pos >= size)
+            return waitOrFail("Invalid JSON file. File must contain an array of questions.");
+        if (m_data.at(pos) != '[')
+            return fail("Invalid JSON file. File must contain an array of questions.");
+        pos = skipWhitespace(pos + 1);
+        if (pos >= size)
+            return waitOrFail("Invalid JSON file. The question array is never closed.");
+        m_started = true;
+        m_pos = pos;
+        if (m_data.at(m_pos) == ']') {
+            m_done = true;
+            return false;
+        }
+    }
+
+    m_pos = skipWhitespace(m_pos); // The last block may have ended mid-whitespace
+    if (m_pos >= size)
+        return waitOrFail("Invalid JSON file. The question array is never closed.");
+
+    const qsizetype end = valueEnd(m_pos);
+    if (end < 0)
+        return waitOrFail(QString("Invalid JSON file. Unterminated value near byte %1.").arg(m_pos));
+
+    const qsizetype after = skipWhitespace(end);
+    if (after >= size)
+        return waitOrFail(QString("Invalid JSON file. Expected ',' or ']' near byte %1.").arg(after));
+
+    start = m_pos;
+    length = end - m_pos;
+
+    if (m_data.at(after) == ',') {
+        m_pos = after + 1;
+    } else if (m_data.at(after) == ']') {
+        m_done = true;
+    } else {
+        return fail(QString("Invalid JSON file. Expected ',' or ']' near byte %1.").arg(after));
+    }
+    return true;
+}
+
+// ---------- LOADER ----------
+QuizLoader::QuizLoader(const QString &filePath, QObject *parent)
+    : QObject(parent),
+      m_filePath(filePath),
+      m_cancelled(std::make_shared<std::atomic_bool>(false))
+{}
+
+void QuizLoader::emitChunk(QList<QuestionSummary> &chunk, QList<QuestionSpan> &chunkSpans,
+                           QList<QuestionSummary> &summaries, QList<QuestionSpan> &spans)
+{
+    if (chunk.isEmpty()) return;
+    emit chunkLoaded(chunk, chunkSpans);
+    summaries.append(chunk);
+    spans.append(chunkSpans);
+    chunk.clear();
+    chunkSpans.clear();
+}
+
+void QuizLoader::run()
+{
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        emit failed("Could not open file for reading.");
+        return;
+    }
+    const QDateTime modified = QFileInfo(file).lastModified();
+    const qint64 total = file.size();
+
+    // Room for the whole file up front, filled in block by block below.
+    // Everybody holding a copy (the window, the scanner) only ever reads
+    // bytes that are already in, so it's filled in place while shared and
+    // never has to be copied or grown.
+    QByteArray data(total, Qt::Uninitialized);
+    char *bytes = data.data();
+    emit sourceLoaded(data);
+
+    // A cached index can be handed out as soon as the bytes it points at are
+    // in; the hash that proves it still fits is only known at the very end.
+    QByteArray cachedHash;
+    QList<QuestionSummary> cachedSummaries;
+    QList<QuestionSpan> cachedSpans;
+    const bool cached = QuizParseCache::load(m_filePath, modified, total, cachedHash, cachedSummaries, cachedSpans);
+    qsizetype cachedSent = 0;
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    QuizScanner scanner(data, true);
+    QList<QuestionSummary> summaries;
+    QList<QuestionSpan> spans;
+    QList<QuestionSummary> chunk;
+    QList<QuestionSpan> chunkSpans;
+    chunk.reserve(CHUNK_SIZE);
+    chunkSpans.reserve(CHUNK_SIZE);
+
+    // Everything the scanner can finish with the bytes read so far.
+    auto scan = [&]() {
+        qsizetype start = 0;
+        qsizetype length = 0;
+        while (scanner.next(start, length)) {
+            if (*m_cancelled) return false;
+            // Same as before: anything that isn't an object is quietly skipped.
+            if (bytes[start] != '{') continue;
+
+            // Only the summary is read now; the question itself gets decoded
+            // the first time it's selected.
+            chunk.append(scanner.summarize(start, length));
+            chunkSpans.append(QuestionSpan{start, length});
+            if (chunk.size() >= CHUNK_SIZE) emitChunk(chunk, chunkSpans, summaries, spans);
+        }
+        return true;
+    };
+
+    qint64 read = 0;
+    while (read < total) {
+        if (*m_cancelled) {
+            emit finished(true);
+            return;
+        }
+        const qint64 got = file.read(bytes + read, qMin(READ_BLOCK, total - read));
+        if (got <= 0) break; // Shorter than it said; the scanner will say what's missing
+        hash.addData(QByteArrayView(bytes + read, got));
+        read += got;
+
+        if (cached) {
+            qsizetype ready = cachedSent;
+            while (ready < cachedSpans.size() && cachedSpans[ready].offset + cachedSpans[ready].length <= read) ++ready;
+            for (; cachedSent < ready; cachedSent += CHUNK_SIZE) {
+                const qsizetype count = qMin<qsizetype>(CHUNK_SIZE, ready - cachedSent);
+                emit chunkLoaded(cachedSummaries.mid(cachedSent, count), cachedSpans.mid(cachedSent, count));
+            }
+            cachedSent = ready;
+        } else {
+            scanner.setAvailable(read);
+            if (!scan()) {
+                emit finished(true);
+                return;
+            }
+            // Whatever's complete goes out now rather than waiting for a full chunk.
+            emitChunk(chunk, chunkSpans, summaries, spans);
+        }
+        emit progress(read, total);
+    }
+    file.close();
+
+    if (cached) {
+        if (read == total && hash.result() == cachedHash && cachedSent == cachedSpans.size()) {
+            emit progress(total, total);
+            emit finished(false);
+            return;
+        }
+        // The index didn't fit after all. It's only a cache: forget it, take
+        // back what was sent and scan the bytes we already have like any
+        // uncached file.
+        QuizParseCache::remove(m_filePath); // Stale, so it never gets matched again
+        if (cachedSent > 0) emit restarted();
+    }
+
+    scanner.setAvailable(read);
+    scanner.finishInput();
+    if (!scan()) {
+        emit finished(true);
+        return;
+    }
+    if (scanner.hasError()) {
+        emit failed(scanner.errorString());
+        return;
+    }
+    emitChunk(chunk, chunkSpans, summaries, spans);
+    emit progress(total, total);
+    emit finished(false);
+
+    // The window already has everything; writing the cache for next time
+    // happens after we've said we're done so it never delays the UI.
+    QuizParseCache::store(m_filePath, modified, total, hash.result(), summaries, spans);
+}
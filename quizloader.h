@@ -0,0 +1,101 @@
+#ifndef QUIZLOADER_H
+#define QUIZLOADER_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <atomic>
+#include <memory>
+#include "questionstore.h"
+
+// Walks the top-level array of a quiz file one element at a time, without
+// building a QJsonDocument for the whole file. Each call to next() hands back
+// the byte range of the next question so it can be parsed on its own.
+// The data can still be arriving: only the first available() bytes are
+// looked at, and next() just returns false (no error) when the next element
+// isn't all there yet. Call setAvailable() as more comes in, and
+// finishInput() at the end so a cut-off file is reported as one.
+class QuizScanner
+{
+public:
+    // Streaming starts with nothing available, see setAvailable().
+    explicit QuizScanner(const QByteArray &data, bool streaming = false);
+
+    void setAvailable(qsizetype bytes) { m_available = qMin(bytes, m_data.size()); }
+    qsizetype available() const { return m_available; }
+    void finishInput() { m_complete = true; }
+    bool isDone() const { return m_done; }
+
+    bool next(qsizetype &start, qsizetype &length);
+    // Pulls "type", "question" and the media image out of the object at start
+    // without parsing the rest of it.
+    QuestionSummary summarize(qsizetype start, qsizetype length) const;
+    bool hasError() const { return !m_error.isEmpty(); }
+    QString errorString() const { return m_error; }
+
+private:
+    qsizetype skipWhitespace(qsizetype pos) const;
+    qsizetype valueEnd(qsizetype pos) const;
+    QString decodeString(qsizetype pos, qsizetype length) const;
+    template<typename Fn> void forEachMember(qsizetype start, qsizetype length, Fn fn) const;
+    bool fail(const QString &message);
+    bool waitOrFail(const QString &message);
+
+    QByteArray m_data;
+    qsizetype m_available;
+    qsizetype m_pos;
+    bool m_started;
+    bool m_done;
+    bool m_complete;
+    QString m_error;
+};
+
+// Reads and indexes a quiz file on a worker thread. Questions aren't decoded
+// here at all: each one is handed back as a summary plus the byte span of its
+// text, in chunks so the list can fill in (and be edited!) before the whole
+// file has been read. The file is read in READ_BLOCK pieces and every
+// question that's complete is handed out straight away, so the first ones
+// show up after one block, not after the whole file. Move it to a QThread
+// and connect QThread::started to run().
+class QuizLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit QuizLoader(const QString &filePath, QObject *parent = nullptr);
+
+    QString filePath() const { return m_filePath; }
+
+    // Hold on to this to cancel from the GUI thread. It's shared, so it stays
+    // valid even after the loader has finished and deleted itself.
+    std::shared_ptr<std::atomic_bool> cancelFlag() const { return m_cancelled; }
+
+    static constexpr int CHUNK_SIZE = 250;
+    static constexpr qint64 READ_BLOCK = 256 * 1024;
+
+public slots:
+    void run();
+
+signals:
+    // Emitted once, before the first chunk. Spans point into these bytes.
+    // It's the whole file's size from the start but filled in as it's read;
+    // a chunk's spans are always in before the chunk is sent.
+    void sourceLoaded(const QByteArray &data);
+    void progress(qint64 bytesDone, qint64 bytesTotal);
+    void chunkLoaded(const QList<QuestionSummary> &summaries, const QList<QuestionSpan> &spans);
+    // The chunks sent so far came from a cached index that turned out not to
+    // match the file. Throw them away; the ones that follow start over.
+    void restarted();
+    void finished(bool cancelled);
+    void failed(const QString &message);
+
+private:
+    void emitChunk(QList<QuestionSummary> &chunk, QList<QuestionSpan> &chunkSpans,
+                   QList<QuestionSummary> &summaries, QList<QuestionSpan> &spans);
+
+    QString m_filePath;
+    std::shared_ptr<std::atomic_bool> m_cancelled;
+};
+
+#endif // QUIZLOADER_H
@@ -0,0 +1,84 @@
+#include "quizsaver.h"
+#include "quizwriter.h"
+#include "parsecache.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonParseError>
+#include <QSaveFile>
+
+QuizSaver::QuizSaver(const QString &filePath, const QuestionStore::Snapshot &snapshot, QObject *parent)
+    : QObject(parent),
+      m_filePath(filePath),
+      m_snapshot(snapshot)
+{}
+
+void QuizSaver::run()
+{
+    // No Text mode: untouched questions are copied byte-for-byte, line endings included.
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        emit failed(QString("Could not open file for writing: %1").arg(file.errorString()));
+        return;
+    }
+
+    // Only one question's text is ever built at a time; QSaveFile buffers the writes.
+    QuizWriter writer(&file, m_snapshot.format);
+    QList<QuestionSpan> spans;
+    spans.reserve(m_snapshot.items.size());
+    bool ok = true;
+    for (const QuestionStore::Snapshot::Item &item : m_snapshot.items) {
+        if (item.reusable) {
+            ok = writer.writeElement(item.text);
+        } else if (!item.text.isEmpty()) {
+            // Text in the other format: decode it here, off the GUI thread.
+            // Text that doesn't even parse is written back untouched.
+            QJsonParseError error;
+            const QJsonObject question = QJsonDocument::fromJson(item.text, &error).object();
+            ok = error.error == QJsonParseError::NoError ? writer.writeQuestion(question)
+                                                         : writer.writeElement(item.text);
+        } else {
+            ok = writer.writeQuestion(QuestionCodec::decode(item.encoded));
+        }
+        if (!ok) break;
+        spans.append(writer.lastSpan());
+    }
+    if (!ok || !writer.finish() || !file.commit()) {
+        emit failed(QString("Could not write the file: %1").arg(file.errorString()));
+        return;
+    }
+
+    // The file on disk becomes the store's new source and every saved question
+    // points into it, so nothing we serialized has to be kept around. It's
+    // mapped, not read, so the new bank never sits in memory next to the old
+    // one. Windows won't let the next save replace a mapped file, so there
+    // it's still read. If neither works the store carries on with what it had.
+    auto written = std::make_shared<QFile>(m_filePath);
+    std::shared_ptr<QFile> sourceFile;
+    QByteArray source;
+    if (written->open(QIODevice::ReadOnly)) {
+#ifndef Q_OS_WIN
+        if (const uchar *mapped = written->map(0, written->size())) {
+            source = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), written->size());
+            sourceFile = written;
+        }
+#endif
+        if (source.isEmpty()) source = written->readAll();
+    }
+    if (source.isEmpty()) {
+        emit finished(m_snapshot, QList<QuestionSpan>(), QByteArray(), nullptr);
+        return;
+    }
+    emit finished(m_snapshot, spans, source, sourceFile);
+
+    // What we just wrote is also what the next open would parse, so prime
+    // the parse cache while we still have everything at hand.
+    QList<QuestionSummary> summaries;
+    summaries.reserve(m_snapshot.items.size());
+    for (const QuestionStore::Snapshot::Item &item : m_snapshot.items)
+        summaries.append(item.summary);
+    const QFileInfo info(*written);
+    QuizParseCache::store(m_filePath, info.lastModified(), info.size(),
+                          QCryptographicHash::hash(source, QCryptographicHash::Sha1), summaries, spans);
+}
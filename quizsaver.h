@@ -0,0 +1,41 @@
+#ifndef QUIZSAVER_H
+#define QUIZSAVER_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include "questionstore.h"
+
+// Serializes a snapshot of the questions and writes it on a worker thread.
+// Questions are streamed into the file one by one through QuizWriter, and
+// the file is a QSaveFile, so the old bank stays intact until the new one is
+// completely on disk. Move it to a QThread and connect QThread::started to
+// run(), just like QuizLoader.
+class QuizSaver : public QObject
+{
+    Q_OBJECT
+
+public:
+    QuizSaver(const QString &filePath, const QuestionStore::Snapshot &snapshot, QObject *parent = nullptr);
+
+    QString filePath() const { return m_filePath; }
+
+public slots:
+    void run();
+
+signals:
+    // source is the file as written, spans where each snapshot item ended
+    // up in it. Both are empty when the file couldn't be read back. Where
+    // the file is mapped rather than read, sourceFile holds the mapping and
+    // has to be kept for as long as source is.
+    void finished(const QuestionStore::Snapshot &snapshot, const QList<QuestionSpan> &spans, const QByteArray &source,
+                  std::shared_ptr<QFile> sourceFile);
+    void failed(const QString &message);
+
+private:
+    QString m_filePath;
+    QuestionStore::Snapshot m_snapshot;
+};
+
+#endif // QUIZSAVER_H
@@ -0,0 +1,48 @@
+#include "quizwriter.h"
+
+QuizWriter::QuizWriter(QIODevice *device, QJsonDocument::JsonFormat format)
+    : m_device(device),
+      m_format(format)
+{}
+
+// QJsonDocument writes a lone object at depth 0. Inside an indented array
+// every line after the opening brace sits one level (4 spaces) deeper.
+QByteArray QuizWriter::elementText(const QJsonObject &question, QJsonDocument::JsonFormat format)
+{
+    QByteArray text = QJsonDocument(question).toJson(format);
+    if (format == QJsonDocument::Indented) {
+        text.chop(1); // trailing newline
+        text.replace("\n", "\n    ");
+    }
+    return text;
+}
+
+bool QuizWriter::put(const QByteArray &bytes)
+{
+    if (!m_ok) return false;
+    m_ok = m_device->write(bytes) == bytes.size();
+    m_written += bytes.size();
+    return m_ok;
+}
+
+bool QuizWriter::writeQuestion(const QJsonObject &question)
+{
+    return writeElement(elementText(question, m_format));
+}
+
+bool QuizWriter::writeElement(const QByteArray &text)
+{
+    const bool indented = m_format == QJsonDocument::Indented;
+    if (m_count == 0) put(indented ? "[\n    " : "[");
+    else put(indented ? ",\n    " : ",");
+    m_lastSpan = QuestionSpan{m_written, text.size()};
+    ++m_count;
+    return put(text);
+}
+
+bool QuizWriter::finish()
+{
+    const bool indented = m_format == QJsonDocument::Indented;
+    if (m_count == 0) return put(indented ? "[\n]\n" : "[]");
+    return put(indented ? "\n]\n" : "]");
+}
@@ -0,0 +1,41 @@
+#ifndef QUIZWRITER_H
+#define QUIZWRITER_H
+
+#include <QByteArray>
+#include <QIODevice>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include "questionstore.h"
+
+// Writes a quiz array to a device one question at a time, so a save never
+// needs the whole file (or a QJsonArray of it) in memory. The output matches
+// what QJsonDocument::toJson() produces for the same array in either format.
+class QuizWriter
+{
+public:
+    QuizWriter(QIODevice *device, QJsonDocument::JsonFormat format);
+
+    // Element text exactly as it appears inside the array (first line not
+    // indented, no separator).
+    static QByteArray elementText(const QJsonObject &question, QJsonDocument::JsonFormat format);
+
+    bool writeQuestion(const QJsonObject &question);
+    // For text that's already been serialized in this writer's format.
+    bool writeElement(const QByteArray &text);
+    bool finish();
+
+    // Where the last element landed in the output.
+    QuestionSpan lastSpan() const { return m_lastSpan; }
+
+private:
+    bool put(const QByteArray &bytes);
+
+    QIODevice *m_device;
+    QJsonDocument::JsonFormat m_format;
+    qint64 m_written = 0;
+    int m_count = 0;
+    QuestionSpan m_lastSpan;
+    bool m_ok = true;
+};
+
+#endif // QUIZWRITER_H
@@ -0,0 +1,177 @@
+#include "searchindex.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <vector>
+
+namespace {
+
+void collectStrings(const QJsonValue &value, QStringList &out)
+{
+    if (value.isString()) {
+        out.append(value.toString());
+    } else if (value.isArray()) {
+        for (const QJsonValue &item : value.toArray()) collectStrings(item, out);
+    } else if (value.isObject()) {
+        const QJsonObject object = value.toObject();
+        for (auto it = object.constBegin(); it != object.constEnd(); ++it) collectStrings(it.value(), out);
+    }
+}
+
+// Sorted lists in, one sorted list out, each id once: a k-way merge that
+// always takes the smallest head next.
+QList<quint64> unite(const QList<const QList<quint64>*> &lists)
+{
+    if (lists.size() == 1) return *lists.first();
+
+    using Head = std::pair<quint64, qsizetype>; // Next id, which list
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+    QList<qsizetype> next(lists.size(), 0);
+    qsizetype total = 0;
+    for (qsizetype i = 0; i < lists.size(); ++i) {
+        total += lists[i]->size();
+        if (!lists[i]->isEmpty()) heads.push({lists[i]->first(), i});
+    }
+
+    QList<quint64> ids;
+    ids.reserve(total);
+    while (!heads.empty()) {
+        const auto [id, list] = heads.top();
+        heads.pop();
+        if (ids.isEmpty() || ids.last() != id) ids.append(id);
+        if (++next[list] < lists[list]->size()) heads.push({lists[list]->at(next[list]), list});
+    }
+    return ids;
+}
+
+} // namespace
+
+// ---------- INDEX ----------
+QStringList SearchIndex::tokenize(const QString &text)
+{
+    QStringList tokens;
+    const QString folded = text.toCaseFolded();
+    qsizetype start = -1;
+    for (qsizetype i = 0; i <= folded.size(); ++i) {
+        const bool word = i < folded.size() && folded.at(i).isLetterOrNumber();
+        if (word && start < 0) {
+            start = i;
+        } else if (!word && start >= 0) {
+            tokens.append(folded.mid(start, i - start));
+            start = -1;
+        }
+    }
+    return tokens;
+}
+
+void SearchIndex::update(quint64 id, quint64 revision, const QJsonObject &question)
+{
+    remove(id);
+
+    QStringList strings;
+    collectStrings(question, strings);
+    QSet<QString> unique;
+    for (const QString &string : std::as_const(strings)) {
+        for (const QString &token : tokenize(string)) unique.insert(token);
+    }
+
+    Document document;
+    document.revision = revision;
+    document.tokens.reserve(unique.size());
+    for (const QString &token : std::as_const(unique)) {
+        auto it = m_postings.find(token);
+        if (it == m_postings.end()) it = m_postings.insert(token, QList<quint64>());
+        // Ids only grow, so this is nearly always an append.
+        QList<quint64> &ids = it.value();
+        if (ids.isEmpty() || ids.last() < id) {
+            ids.append(id);
+        } else {
+            ids.insert(std::lower_bound(ids.begin(), ids.end(), id) - ids.begin(), id);
+        }
+        document.tokens.append(it.key());
+    }
+    m_documents.insert(id, document);
+}
+
+void SearchIndex::remove(quint64 id)
+{
+    const auto doc = m_documents.constFind(id);
+    if (doc == m_documents.cend()) return;
+    for (const QString &token : doc->tokens) {
+        auto it = m_postings.find(token);
+        if (it == m_postings.end()) continue;
+        QList<quint64> &ids = it.value();
+        const auto found = std::lower_bound(ids.begin(), ids.end(), id);
+        if (found != ids.end() && *found == id) ids.erase(found);
+        if (ids.isEmpty()) m_postings.erase(it);
+    }
+    m_documents.erase(doc);
+}
+
+void SearchIndex::clear()
+{
+    m_postings.clear();
+    m_documents.clear();
+}
+
+QList<quint64> SearchIndex::idsWithPrefix(const QString &prefix) const
+{
+    QList<const QList<quint64>*> lists;
+    for (auto it = m_postings.lowerBound(prefix); it != m_postings.cend() && it.key().startsWith(prefix); ++it)
+        lists.append(&it.value());
+    if (lists.isEmpty()) return QList<quint64>();
+    return unite(lists);
+}
+
+QList<quint64> SearchIndex::search(const QString &query) const
+{
+    const QStringList terms = tokenize(query);
+    if (terms.isEmpty()) return QList<quint64>();
+
+    QList<QList<quint64>> matches;
+    matches.reserve(terms.size());
+    for (const QString &term : terms) {
+        QList<quint64> ids = idsWithPrefix(term);
+        if (ids.isEmpty()) return QList<quint64>();
+        matches.append(std::move(ids));
+    }
+
+    // Rarest word first, so every intersection after it only gets smaller.
+    std::sort(matches.begin(), matches.end(),
+              [](const QList<quint64> &a, const QList<quint64> &b) { return a.size() < b.size(); });
+    QList<quint64> result = std::move(matches.first());
+    for (qsizetype i = 1; i < matches.size() && !result.isEmpty(); ++i) {
+        QList<quint64> both;
+        both.reserve(result.size());
+        std::set_intersection(result.cbegin(), result.cend(), matches[i].cbegin(), matches[i].cend(),
+                              std::back_inserter(both));
+        result = std::move(both);
+    }
+    return result;
+}
+
+// ---------- INDEXER ----------
+SearchIndexer::SearchIndexer(const QuestionStore::Snapshot &snapshot, QObject *parent)
+    : QObject(parent),
+      m_snapshot(snapshot),
+      m_cancelled(std::make_shared<std::atomic_bool>(false))
+{}
+
+void SearchIndexer::run()
+{
+    auto index = std::make_shared<SearchIndex>();
+    for (const QuestionStore::Snapshot::Item &item : std::as_const(m_snapshot.items)) {
+        if (*m_cancelled) {
+            emit finished(m_snapshot.document, nullptr);
+            return;
+        }
+        const QJsonObject question = item.text.isEmpty() ? QuestionCodec::decode(item.encoded)
+                                                         : QJsonDocument::fromJson(item.text).object();
+        index->update(item.id, item.revision, question);
+    }
+    emit finished(m_snapshot.document, index);
+}
@@ -0,0 +1,81 @@
+#ifndef SEARCHINDEX_H
+#define SEARCHINDEX_H
+
+#include <QObject>
+#include <QHash>
+#include <QJsonObject>
+#include <QList>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <atomic>
+#include <memory>
+#include "questionstore.h"
+
+// An inverted index over every string in every question: question text,
+// options, sentence parts, answers, hints, media paths, and the same again
+// inside multi_questions. Questions are tracked by their store id, so the
+// index survives questions being added, removed or moved around.
+class SearchIndex
+{
+public:
+    // Lower-cased runs of letters and digits; "images/Cat_01.png" gives
+    // "images", "cat", "01", "png".
+    static QStringList tokenize(const QString &text);
+
+    void update(quint64 id, quint64 revision, const QJsonObject &question);
+    void remove(quint64 id);
+    void clear();
+
+    bool contains(quint64 id) const { return m_documents.contains(id); }
+    quint64 revisionOf(quint64 id) const { return m_documents.value(id).revision; }
+    QList<quint64> ids() const { return m_documents.keys(); }
+
+    // Ids (ascending) of the questions containing every word of the query,
+    // each word matched as a prefix so results show up while the user is
+    // still typing.
+    QList<quint64> search(const QString &query) const;
+
+private:
+    struct Document
+    {
+        QStringList tokens; // Unique, sharing their data with the m_postings keys
+        quint64 revision = 0;
+    };
+
+    // Every id under any token starting with prefix, ascending, no repeats.
+    QList<quint64> idsWithPrefix(const QString &prefix) const;
+
+    // Sorted, so prefixes are one range; each id list is ascending too, so
+    // lists merge and intersect in one pass.
+    QMap<QString, QList<quint64>> m_postings;
+    QHash<quint64, Document> m_documents;
+};
+Q_DECLARE_METATYPE(std::shared_ptr<SearchIndex>)
+
+// Builds a SearchIndex from a store snapshot on a worker thread, decoding
+// every question once. Move it to a QThread and connect QThread::started to
+// run(), just like QuizLoader.
+class SearchIndexer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SearchIndexer(const QuestionStore::Snapshot &snapshot, QObject *parent = nullptr);
+
+    std::shared_ptr<std::atomic_bool> cancelFlag() const { return m_cancelled; }
+
+public slots:
+    void run();
+
+signals:
+    // index is null when the build was cancelled.
+    void finished(quint64 document, std::shared_ptr<SearchIndex> index);
+
+private:
+    QuestionStore::Snapshot m_snapshot;
+    std::shared_ptr<std::atomic_bool> m_cancelled;
+};
+
+#endif // SEARCHINDEX_H
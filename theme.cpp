@@ -0,0 +1,114 @@
+#include "theme.h"
+
+#include <QApplication>
+#include <QPalette>
+#include <QStyle>
+#include <QWidget>
+
+namespace Theme {
+
+QString styleSheet()
+{
+    return QStringLiteral(R"(
+        QWidget { font-family: 'Arial'; font-size: 12pt; color: #8B008B; }
+        QMainWindow, QDialog { background-color: #FFB6C1; } /* Light Pink */
+        QFrame, QGroupBox { background-color: #FFC0CB; } /* Pink */
+        QMenuBar, QMenu { background-color: #FFC0CB; }
+        QLabel, QRadioButton, QCheckBox { background-color: transparent; }
+        QPushButton {
+            background-color: #FF1493; /* Deep Pink */
+            color: #FFFFFF;
+            border: 1px solid #FF69B4;
+            border-radius: 5px;
+            padding: 8px 12px;
+            font-weight: bold;
+        }
+        QPushButton:hover { background-color: #FF69B4; } /* Hot Pink */
+        QPushButton:pressed { background-color: #C71585; } /* Medium Violet Red */
+        QLineEdit, QTextEdit, QPlainTextEdit {
+            background-color: #FFEFD5; /* Papaya Whip */
+            border: 1px solid #FFC0CB;
+            border-radius: 5px;
+            padding: 5px;
+        }
+        QComboBox { background-color: #FFFFFF; border: 1px solid #FFC0CB; border-radius: 5px; padding: 5px; }
+        QListWidget, QListView#questionList {
+            background-color: #FFEFD5;
+            border: 1px solid #FFC0CB;
+            border-radius: 5px;
+            padding: 4px;
+        }
+        QListWidget::item:selected, QListView#questionList::item:selected {
+            background-color: #FF69B4;
+            color: #FFFFFF;
+        }
+        QGroupBox {
+            font-weight: bold;
+            font-size: 14px;
+            border: 1px solid #FF69B4;
+            border-radius: 5px;
+            margin-top: 10px;
+        }
+        QGroupBox::title {
+            subcontrol-origin: margin;
+            subcontrol-position: top center;
+            padding: 0 3px;
+            background-color: #FFB6C1;
+        }
+        QScrollArea { border: none; background-color: white; }
+        QSplitter::handle { background-color: #FF69B4; }
+
+        /* Roles, set with Theme::setRole() */
+        QLabel[role="tip"], QLabel[role="summary"] { font-style: italic; color: #8B008B; }
+        QLabel[role="rowTitle"] { font-weight: bold; color: #8B008B; }
+        QLabel[role="cardTitle"] { font-weight: bold; font-size: 14px; color: #8B008B; }
+        QLabel[role="sectionTitle"] { font-weight: bold; font-size: 16px; color: #8B008B; }
+        QLabel[role="subheading"] { font-weight: bold; margin-top: 10px; }
+        QWidget[role="row"] { border: 1px solid #FF69B4; border-radius: 5px; margin: 2px; padding: 5px; }
+        QWidget[role="card"] { border: 2px solid #FF69B4; border-radius: 10px; margin: 5px; padding: 10px; }
+        QWidget[role="nestedCard"] {
+            border: 2px solid #FF1493;
+            border-radius: 10px;
+            margin: 10px;
+            padding: 15px;
+            background-color: #FFEFD5;
+        }
+        QLabel[role="error"] { color: red; border: 1px solid red; padding: 10px; }
+        QLabel[role="dialogTitle"] { font-size: 16pt; font-weight: bold; color: #8B008B; }
+        QLabel[role="previewHint"] { color: #C71585; }
+        QLabel[role="welcome"] { font-size: 18pt; color: #8B008B; }
+        QDialog[role="previewDialog"] { background-color: #FFEFD5; }
+    )");
+}
+
+void apply(QApplication &app)
+{
+    // The palette covers whatever the stylesheet doesn't mention.
+    QPalette palette = app.palette();
+    palette.setColor(QPalette::Window, QColor("#FFB6C1"));
+    palette.setColor(QPalette::WindowText, QColor("#8B008B"));
+    palette.setColor(QPalette::Base, QColor("#FFEFD5"));
+    palette.setColor(QPalette::AlternateBase, QColor("#FFE4E1"));
+    palette.setColor(QPalette::Text, QColor("#8B008B"));
+    palette.setColor(QPalette::Button, QColor("#FF1493"));
+    palette.setColor(QPalette::ButtonText, QColor("#FFFFFF"));
+    palette.setColor(QPalette::Highlight, QColor("#FF69B4"));
+    palette.setColor(QPalette::HighlightedText, QColor("#FFFFFF"));
+    palette.setColor(QPalette::ToolTipBase, QColor("#FFEFD5"));
+    palette.setColor(QPalette::ToolTipText, QColor("#8B008B"));
+    app.setPalette(palette);
+    app.setStyleSheet(styleSheet());
+}
+
+void setRole(QWidget *widget, const char *role)
+{
+    if (!widget) return;
+    widget->setProperty("role", QString::fromLatin1(role));
+    // Property selectors are only matched when a widget gets polished.
+    if (widget->testAttribute(Qt::WA_WState_Polished)) {
+        widget->style()->unpolish(widget);
+        widget->style()->polish(widget);
+    }
+}
+
+}
@@ -0,0 +1,30 @@
+#ifndef THEME_H
+#define THEME_H
+
+#include <QString>
+
+class QApplication;
+class QWidget;
+
+// 💖 The one and only pink theme. Everything is styled from a single
+// application stylesheet (plus a matching palette), installed once at
+// startup. Widgets that need a special look get a "role" property instead
+// of their own setStyleSheet(): a per-widget sheet makes Qt build a fresh
+// style for that widget and all its children, which is most of what
+// building an editor used to cost.
+//
+// Roles (see the [role=...] rules in theme.cpp):
+//   tip, rowTitle, cardTitle, sectionTitle, subheading, summary,
+//   row, card, nestedCard, error, dialogTitle, previewHint, welcome,
+//   previewDialog
+namespace Theme {
+
+void apply(QApplication &app);
+QString styleSheet();
+
+// Safe to call on widgets that are already showing; they get re-polished.
+void setRole(QWidget *widget, const char *role);
+
+}
+
+#endif // THEME_H
@@ -0,0 +1,174 @@
+#include "thumbnailcache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <atomic>
+
+namespace {
+
+struct HashedFile
+{
+    qint64 size = -1;
+    qint64 modified = 0;
+    QByteArray hash;
+};
+
+QMutex s_mutex;
+QHash<QString, HashedFile> s_hashes; // By path
+QHash<QString, qint64> s_totalBytes; // By directory, once it's been measured
+std::atomic<quint64> s_hits{0};
+std::atomic<quint64> s_misses{0};
+
+// Everything in a cache directory, oldest (least recently used) first.
+QFileInfoList cacheEntries(const QString &dir)
+{
+    return QDir(dir).entryInfoList(QDir::Files, QDir::Time | QDir::Reversed);
+}
+
+}
+
+QString ThumbnailCache::directory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/thumbnails";
+}
+
+QString ThumbnailCache::tileDirectory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/tiles";
+}
+
+QString ThumbnailCache::fileFor(const QByteArray &contentHash, int width)
+{
+    return directory() + "/" + QString::fromLatin1(contentHash.toHex()) + "-" + QString::number(width) + ".thumb";
+}
+
+QString ThumbnailCache::tileFileFor(const QByteArray &key)
+{
+    const QByteArray name = QCryptographicHash::hash(key, QCryptographicHash::Sha1).toHex();
+    return tileDirectory() + "/" + QString::fromLatin1(name) + ".png";
+}
+
+QByteArray ThumbnailCache::contentHash(const QString &path)
+{
+    const QFileInfo info(path);
+    const qint64 size = info.size();
+    const qint64 modified = info.lastModified().toMSecsSinceEpoch();
+    {
+        QMutexLocker locker(&s_mutex);
+        const auto it = s_hashes.constFind(path);
+        if (it != s_hashes.cend() && it->size == size && it->modified == modified) return it->hash;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return QByteArray();
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+
+    QMutexLocker locker(&s_mutex);
+    HashedFile &entry = s_hashes[path];
+    entry = {size, modified, hash.result()};
+    return entry.hash;
+}
+
+QImage ThumbnailCache::load(const QByteArray &contentHash, int width)
+{
+    if (contentHash.isEmpty()) return QImage();
+    const QImage image = read(fileFor(contentHash, width));
+    if (image.isNull()) ++s_misses;
+    else ++s_hits;
+    return image;
+}
+
+void ThumbnailCache::store(const QByteArray &contentHash, int width, const QImage &image)
+{
+    if (contentHash.isEmpty() || image.isNull()) return;
+    const bool alpha = image.hasAlphaChannel();
+    write(directory(), fileFor(contentHash, width), image, alpha ? "PNG" : "JPG", alpha ? -1 : 90);
+}
+
+QImage ThumbnailCache::loadTile(const QByteArray &key)
+{
+    if (key.isEmpty()) return QImage();
+    return read(tileFileFor(key));
+}
+
+void ThumbnailCache::storeTile(const QByteArray &key, const QImage &image)
+{
+    if (key.isEmpty() || image.isNull()) return;
+    write(tileDirectory(), tileFileFor(key), image, "PNG", -1);
+}
+
+QImage ThumbnailCache::read(const QString &path)
+{
+    QImage image;
+    if (!image.load(path)) return QImage(); // Format comes from the content, png or jpg
+
+    // Touching it is what makes eviction least-recently-used.
+    QFile file(path);
+    if (file.open(QIODevice::ReadWrite)) file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    return image;
+}
+
+void ThumbnailCache::write(const QString &dir, const QString &path, const QImage &image, const char *format, int quality)
+{
+    if (!QDir().mkpath(dir)) return;
+
+    // Written aside and renamed into place, so another thread never reads half a file.
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) return;
+    if (!image.save(&file, format, quality) || !file.commit()) return;
+
+    const qint64 written = QFileInfo(file.fileName()).size();
+    bool full = false;
+    {
+        QMutexLocker locker(&s_mutex);
+        auto it = s_totalBytes.find(dir);
+        if (it == s_totalBytes.end()) {
+            // First store this run: measure what earlier runs left behind.
+            it = s_totalBytes.insert(dir, 0);
+            for (const QFileInfo &entry : cacheEntries(dir)) *it += entry.size();
+        } else {
+            *it += written;
+        }
+        full = *it > MAX_BYTES;
+    }
+    if (full) evict(dir);
+}
+
+void ThumbnailCache::evict(const QString &dir)
+{
+    QMutexLocker locker(&s_mutex);
+    const QFileInfoList entries = cacheEntries(dir);
+    qint64 total = 0;
+    for (const QFileInfo &entry : entries) total += entry.size();
+    for (const QFileInfo &entry : entries) {
+        if (total <= EVICT_TO_BYTES) break;
+        if (QFile::remove(entry.absoluteFilePath())) total -= entry.size();
+    }
+    s_totalBytes[dir] = total;
+}
+
+quint64 ThumbnailCache::hits()
+{
+    return s_hits;
+}
+
+quint64 ThumbnailCache::misses()
+{
+    return s_misses;
+}
+
+double ThumbnailCache::hitRate()
+{
+    const quint64 hits = s_hits;
+    const quint64 lookups = hits + s_misses;
+    return lookups ? double(hits) / lookups : 0.0;
+}
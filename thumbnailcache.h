@@ -0,0 +1,50 @@
+#ifndef THUMBNAILCACHE_H
+#define THUMBNAILCACHE_H
+
+#include <QByteArray>
+#include <QImage>
+#include <QString>
+
+// Small decoded copies of quiz images, kept as files in the user cache
+// directory, so opening a question again (even after a restart) doesn't
+// decode the 4K original again. Entries are keyed by the image's content
+// hash and width: a copied or renamed photo still hits, an edited one
+// misses. The directory is kept under MAX_BYTES by dropping the least
+// recently used thumbnails. Safe to call from any thread.
+// Tiles of big images (see ImagePyramid) live in a directory of their own,
+// with their own budget, and don't count towards the hit rate.
+class ThumbnailCache
+{
+public:
+    // Remembered per path, size and modification time, so each file is only
+    // read for hashing once per run.
+    static QByteArray contentHash(const QString &path);
+
+    static QImage load(const QByteArray &contentHash, int width);
+    static void store(const QByteArray &contentHash, int width, const QImage &image);
+
+    static quint64 hits();
+    static quint64 misses();
+    static double hitRate(); // 0..1, 0 before the first lookup
+    static QString directory();
+
+    // Keyed by whatever the caller likes (path, size and mtime, say), since
+    // hashing a huge image before its first tile is exactly the wait tiles
+    // are there to avoid. Always PNG: tiles are drawn edge to edge, and JPEG
+    // seams would show.
+    static QImage loadTile(const QByteArray &key);
+    static void storeTile(const QByteArray &key, const QImage &image);
+    static QString tileDirectory();
+
+private:
+    static QString fileFor(const QByteArray &contentHash, int width);
+    static QString tileFileFor(const QByteArray &key);
+    static QImage read(const QString &path);
+    static void write(const QString &dir, const QString &path, const QImage &image, const char *format, int quality);
+    static void evict(const QString &dir);
+
+    static constexpr qint64 MAX_BYTES = 256 * 1024 * 1024;
+    static constexpr qint64 EVICT_TO_BYTES = MAX_BYTES / 4 * 3; // Some room, so we don't evict on every store
+};
+
+#endif // THUMBNAILCACHE_H
@@ -0,0 +1,248 @@
+#include "tiledimageview.h"
+#include "imagepyramid.h"
+
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QResizeEvent>
+#include <QWheelEvent>
+#include <QtMath>
+
+TiledImageView::TiledImageView(QWidget *parent)
+    : QWidget(parent)
+    , m_pyramid(new ImagePyramid(this))
+{
+    connect(m_pyramid, &ImagePyramid::tileReady, this, qOverload<>(&QWidget::update));
+    connect(m_pyramid, &ImagePyramid::sizeKnown, this, [this]() {
+        if (!hasImage()) unsetCursor();
+        fitToView();
+        update();
+        emit imageLoaded();
+    });
+}
+
+bool TiledImageView::setImage(const QString &imagePath)
+{
+    const bool ok = m_pyramid->open(imagePath);
+    if (ok) {
+        setCursor(Qt::OpenHandCursor);
+    } else {
+        unsetCursor();
+    }
+    fitToView();
+    update();
+    return ok;
+}
+
+QString TiledImageView::imagePath() const
+{
+    return m_pyramid->path();
+}
+
+QSize TiledImageView::imageSize() const
+{
+    return m_pyramid->size();
+}
+
+QPointF TiledImageView::mapToImage(const QPointF &viewPoint) const
+{
+    return (viewPoint - m_offset) / m_scale;
+}
+
+QPointF TiledImageView::mapFromImage(const QPointF &imagePoint) const
+{
+    return imagePoint * m_scale + m_offset;
+}
+
+double TiledImageView::fitScale() const
+{
+    const QSize image = imageSize();
+    if (image.isEmpty() || width() <= 0 || height() <= 0) return 1.0;
+    return qMin(double(width()) / image.width(), double(height()) / image.height());
+}
+
+void TiledImageView::setZoom(double scale, const QPointF &anchor)
+{
+    const QPointF imagePoint = mapToImage(anchor);
+    m_fitted = false;
+    scale = qBound(qMin(fitScale(), 1.0), scale, MAX_ZOOM);
+    setView(scale, anchor - imagePoint * scale);
+}
+
+void TiledImageView::fitToView()
+{
+    m_fitted = true;
+    setView(fitScale(), QPointF());
+}
+
+// Everything that moves the image goes through here: a smaller-than-the-view
+// image stays centred, a bigger one can't be dragged off the edge.
+void TiledImageView::setView(double scale, const QPointF &offset)
+{
+    const QSizeF scaled = QSizeF(imageSize()) * scale;
+    QPointF clamped = offset;
+    clamped.setX(scaled.width() <= width() ? (width() - scaled.width()) / 2
+                                           : qBound(width() - scaled.width(), offset.x(), 0.0));
+    clamped.setY(scaled.height() <= height() ? (height() - scaled.height()) / 2
+                                             : qBound(height() - scaled.height(), offset.y(), 0.0));
+
+    if (qFuzzyCompare(scale, m_scale) && clamped == m_offset) return;
+    m_scale = scale;
+    m_offset = clamped;
+    update();
+    emit viewChanged();
+}
+
+// Rounded the same way on every side, so neighbouring tiles meet without seams.
+QRect TiledImageView::viewRect(const QRectF &imageRect) const
+{
+    const QPoint topLeft = mapFromImage(imageRect.topLeft()).toPoint();
+    const QPoint bottomRight = mapFromImage(imageRect.bottomRight()).toPoint();
+    return QRect(topLeft.x(), topLeft.y(), bottomRight.x() - topLeft.x(), bottomRight.y() - topLeft.y());
+}
+
+void TiledImageView::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+
+    if (!hasImage()) {
+        painter.fillRect(rect(), Qt::lightGray);
+        painter.setPen(Qt::darkGray);
+        painter.drawText(rect(), Qt::AlignCenter, imagePath().isEmpty() ? "No Image Loaded" : "Loading image... ✨");
+    } else {
+        painter.fillRect(event->rect(), palette().brush(backgroundRole()));
+        paintTiles(painter, event->rect());
+    }
+    paintOverlay(painter, event->rect());
+}
+
+// The frame always covers the whole view, even when only part of it is being
+// repainted (a tag being dragged): endFrame drops whatever wasn't asked for,
+// and that mustn't be the rest of the screen. Only the damaged tiles get drawn.
+void TiledImageView::paintTiles(QPainter &painter, const QRect &rect)
+{
+    const QRect view = this->rect();
+    const QRectF shown(mapToImage(view.topLeft()), mapToImage(view.bottomRight() + QPoint(1, 1)));
+    const QRectF visible = shown & QRectF(QPointF(), QSizeF(imageSize()));
+    if (visible.isEmpty()) return;
+
+    // Tiles are at most 2x what the screen needs, a smooth shrink hides that.
+    painter.save();
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+    const int level = m_pyramid->levelFor(m_scale * devicePixelRatioF());
+    const int span = ImagePyramid::tileSpan(level);
+    const int firstColumn = int(visible.left()) / span;
+    const int lastColumn = int(qCeil(visible.right()) - 1) / span;
+    const int firstRow = int(visible.top()) / span;
+    const int lastRow = int(qCeil(visible.bottom()) - 1) / span;
+
+    m_pyramid->beginFrame();
+    // The one-tile top level is what fills in while sharper tiles decode.
+    m_pyramid->tile(m_pyramid->levelCount() - 1, 0, 0);
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            if (viewRect(m_pyramid->tileRect(level, column, row)).intersects(rect)) {
+                drawTile(painter, level, column, row);
+            } else {
+                m_pyramid->tile(level, column, row); // Still wanted, just not repainted now
+            }
+        }
+    }
+    m_pyramid->endFrame();
+    painter.restore();
+}
+
+// The tile if it's decoded, otherwise its part of the nearest coarser tile
+// that is, a bit blurry until the real one arrives.
+bool TiledImageView::drawTile(QPainter &painter, int level, int column, int row)
+{
+    const QRect rect = m_pyramid->tileRect(level, column, row);
+    const QRect target = viewRect(rect);
+
+    const QPixmap pixmap = m_pyramid->tile(level, column, row);
+    if (!pixmap.isNull()) {
+        painter.drawPixmap(target, pixmap);
+        return true;
+    }
+
+    for (int coarser = level + 1; coarser < m_pyramid->levelCount(); ++coarser) {
+        const int shift = coarser - level;
+        const QPixmap parent = m_pyramid->cachedTile(coarser, column >> shift, row >> shift);
+        if (parent.isNull()) continue;
+
+        const QRect parentRect = m_pyramid->tileRect(coarser, column >> shift, row >> shift);
+        const double ratio = double(parent.width()) / parentRect.width();
+        const QRectF source(QPointF(rect.topLeft() - parentRect.topLeft()) * ratio, QSizeF(rect.size()) * ratio);
+        painter.drawPixmap(QRectF(target), parent, source);
+        return true;
+    }
+    return false;
+}
+
+void TiledImageView::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    if (m_fitted) {
+        fitToView();
+    } else {
+        setView(m_scale, m_offset);
+    }
+}
+
+void TiledImageView::wheelEvent(QWheelEvent *event)
+{
+    if (!hasImage()) {
+        QWidget::wheelEvent(event);
+        return;
+    }
+    const double notches = event->angleDelta().y() / 120.0;
+    setZoom(m_scale * qPow(WHEEL_STEP, notches), event->position());
+    event->accept();
+}
+
+void TiledImageView::mousePressEvent(QMouseEvent *event)
+{
+    if (hasImage() && (event->button() == Qt::LeftButton || event->button() == Qt::MiddleButton)) {
+        m_panning = true;
+        m_panFrom = event->pos();
+        setCursor(Qt::ClosedHandCursor);
+        event->accept();
+        return;
+    }
+    QWidget::mousePressEvent(event);
+}
+
+void TiledImageView::mouseMoveEvent(QMouseEvent *event)
+{
+    if (!m_panning) {
+        QWidget::mouseMoveEvent(event);
+        return;
+    }
+    const QPoint delta = event->pos() - m_panFrom;
+    m_panFrom = event->pos();
+    setView(m_scale, m_offset + delta);
+}
+
+void TiledImageView::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (m_panning && (event->button() == Qt::LeftButton || event->button() == Qt::MiddleButton)) {
+        m_panning = false;
+        setCursor(Qt::OpenHandCursor);
+        return;
+    }
+    QWidget::mouseReleaseEvent(event);
+}
+
+void TiledImageView::mouseDoubleClickEvent(QMouseEvent *event)
+{
+    if (!hasImage() || event->button() != Qt::LeftButton) {
+        QWidget::mouseDoubleClickEvent(event);
+        return;
+    }
+    if (m_fitted) {
+        setZoom(1.0, event->position());
+    } else {
+        fitToView();
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef TILEDIMAGEVIEW_H
+#define TILEDIMAGEVIEW_H
+
+#include <QPointF>
+#include <QRect>
+#include <QRectF>
+#include <QSize>
+#include <QString>
+#include <QWidget>
+
+class ImagePyramid;
+class QPainter;
+
+// Shows an image of any size through an ImagePyramid: starts fitted to the
+// widget, the wheel zooms around the cursor, dragging pans, double-click
+// flips between fitted and 1:1. Only the tiles on screen are ever decoded.
+class TiledImageView : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit TiledImageView(QWidget *parent = nullptr);
+
+    // False when it can't be read; the view is left empty then. The rare
+    // format that has to be decoded to learn its size comes back true with
+    // no image yet, and imageLoaded follows.
+    bool setImage(const QString &imagePath);
+    QString imagePath() const;
+    QSize imageSize() const;
+    bool hasImage() const { return !imageSize().isEmpty(); }
+
+    // View pixels per image pixel.
+    double zoom() const { return m_scale; }
+    // Zooms keeping the image point under anchor (view coordinates) put.
+    void setZoom(double scale, const QPointF &anchor);
+    void fitToView();
+
+    // Between view and natural image coordinates, at the current zoom and pan.
+    QPointF mapToImage(const QPointF &viewPoint) const;
+    QPointF mapFromImage(const QPointF &imagePoint) const;
+
+signals:
+    // Zoom or pan changed, so anything placed in image coordinates moves.
+    void viewChanged();
+    // See setImage. hasImage() says whether it worked.
+    void imageLoaded();
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseDoubleClickEvent(QMouseEvent *event) override;
+
+    // Drawn over the image, in view coordinates; rect is what's being repainted.
+    virtual void paintOverlay(QPainter &painter, const QRect &rect) { Q_UNUSED(painter) Q_UNUSED(rect) }
+
+private:
+    void paintTiles(QPainter &painter, const QRect &rect);
+    double fitScale() const;
+    void setView(double scale, const QPointF &offset);
+    bool drawTile(QPainter &painter, int level, int column, int row);
+    QRect viewRect(const QRectF &imageRect) const;
+
+    ImagePyramid *m_pyramid;
+    double m_scale = 1.0;
+    QPointF m_offset;    // Where the image's top left is, in view coordinates
+    bool m_fitted = true; // Keep fitting on resize until the user zooms
+
+    bool m_panning = false;
+    QPoint m_panFrom;
+
+    static constexpr double MAX_ZOOM = 8.0;
+    static constexpr double WHEEL_STEP = 1.2; // Per notch
+};
+
+#endif // TILEDIMAGEVIEW_H